@@ -46,6 +46,7 @@ extern "C" {
 #include <cassert>
 #include <chrono>
 #include <iostream>
+#include <string_view>
 #include <thread>
 
 #include "DwmSysLogger.hh"
@@ -61,35 +62,11 @@ using namespace Dwm::WebUtils;
 //----------------------------------------------------------------------------
 static void Usage(const char *argv0)
 {
-  cerr << "usage: " << argv0 << " [-h] URL\n";
-  return;
-}
-
-//----------------------------------------------------------------------------
-//!  
-//----------------------------------------------------------------------------
-template<bool isRequest, class Body, class Fields>
-static void PrintWholeMessage(const http::message<isRequest,Body,Fields> & m)
-{
-  boost::system::error_code ec;
-  http::serializer<isRequest, Body, Fields> sr{m};
-  do
-  {
-    sr.next(ec,
-            [&sr](boost::system::error_code & ec, auto const & buffer)
-            {
-              ec = {};
-              std::cout << make_printable(buffer);
-              sr.consume(buffer_bytes(buffer));
-            });
-  }
-  while (! ec && ! sr.is_done());
-  if (! ec) {
-    std::cout << std::endl;
-  }
-  else {
-    std::cerr << ec.message() << std::endl;
-  }
+  cerr << "usage: " << argv0 << " [-h] URL\n"
+       << "       " << argv0 << " [-c] -o file URL\n"
+       << "  -h: print the response header\n"
+       << "  -o file: save the response body in file\n"
+       << "  -c: resume a partial download into the -o file\n";
   return;
 }
 
@@ -98,32 +75,71 @@ static void PrintWholeMessage(const http::message<isRequest,Body,Fields> & m)
 //----------------------------------------------------------------------------
 int main(int argc, char *argv[])
 {
-  bool  printHeader = false;
-  int   optChar;
+  bool    printHeader = false;
+  bool    resume = false;
+  string  outFile;
+  int     optChar;
   
-  while ((optChar = getopt(argc, argv, "h")) != -1) {
+  while ((optChar = getopt(argc, argv, "cho:")) != -1) {
     switch (optChar) {
+      case 'c':
+        resume = true;
+        break;
       case 'h':
         printHeader = true;
         break;
+      case 'o':
+        outFile = optarg;
+        break;
       default:
         break;
     }
   }
-  if (optind < argc) {
+  if ((optind < argc) && (! outFile.empty())) {
+    TransferStats  stats;
+    GetFailure     getFailure;
+    if (GetToFile(argv[optind], outFile, stats, getFailure, resume)) {
+      cerr << stats.Bytes() << " bytes";
+      if (stats.ResumedAt()) {
+        cerr << " (resumed at " << stats.ResumedAt() << ")";
+      }
+      cerr << " in " << (stats.Elapsed().count() / 1000000.0) << "s ("
+           << (uint64_t)stats.BytesPerSecond() << " bytes/sec)\n";
+      return 0;
+    }
+    else {
+      cerr << "Failed to get '" << argv[optind] << "': "
+           << getFailure.to_string() << '\n';
+      return 1;
+    }
+  }
+  else if (optind < argc) {
     string  urlstr(argv[optind]);
-    http::response<http::string_body>  response;
-    if (GetResponse(urlstr, response)) {
-      if (printHeader) {
-        PrintWholeMessage(response);
+    http::response_header<>  header;
+    bool  headerPrinted = false;
+    //  Write the body to stdout as it arrives rather than holding all of
+    //  it in memory.
+    auto  printChunk = [&] (std::string_view chunk) {
+      if (printHeader && (! headerPrinted)) {
+        cout << header;
+        headerPrinted = true;
       }
-      else {
-        cout << response.body();
+      cout.write(chunk.data(), chunk.size());
+      return cout.good();
+    };
+    GetFailure  getFailure;
+    if (GetStream(urlstr, header, printChunk, getFailure)) {
+      if (printHeader) {
+        if (! headerPrinted) {
+          cout << header;
+        }
+        cout << endl;
       }
       return 0;
     }
     else {
-      cerr << "Failed to get '" << argv[optind] << '\n';
+      cerr << "Failed to get '" << argv[optind] << "': "
+           << getFailure.to_string() << '\n';
       return 1;
     }
   }
@@ -43,6 +43,7 @@
 #define _DWMWEBUTILS_HH_
 
 #include <string>
+#include <vector>
 #include <boost/version.hpp>
 #if (BOOST_VERSION < 108000)
   #define BOOST_BEAST_USE_STD_STRING_VIEW // deprecated with newer boost
@@ -50,7 +51,15 @@
 #include <boost/beast.hpp>
 #include <nlohmann/json.hpp>
 
+#include "DwmWebUtilsConnectionPool.hh"
+#include "DwmWebUtilsFastJson.hh"
 #include "DwmWebUtilsGetFailure.hh"
+#include "DwmWebUtilsPmr.hh"
+#include "DwmWebUtilsRequestContext.hh"
+#include "DwmWebUtilsRequestMetrics.hh"
+#include "DwmWebUtilsRequestOptions.hh"
+#include "DwmWebUtilsTransferStats.hh"
+#include "DwmWebUtilsUrlView.hh"
 
 namespace Dwm {
 
@@ -67,13 +76,203 @@ namespace Dwm {
 
     //------------------------------------------------------------------------
     //!  Fetches the JSON at the given URL @c urlstr and stores it in @c json.
-    //!  Returns true on success, false on failure.  On failure,
-    //!  @c getFailure can be examined for more information.  If @c urlstr is
-    //!  an https URL, will verify the server's certificate unless
-    //!  @c verifyCertificate is @c false.
+    //!  The JSON is parsed as the response body arrives; the body is not
+    //!  buffered.  The response's status code is not checked, so a JSON
+    //!  error document in (say) a 404 response is parsed like any other;
+    //!  use GetResponse() if the status matters.  This holds for all of
+    //!  the GetJson() variants, with or without a cache.  Returns true on
+    //!  success, false on failure.  On failure, @c getFailure can be
+    //!  examined for more information.  If @c urlstr is an https URL,
+    //!  will verify the server's certificate unless @c verifyCertificate
+    //!  is @c false.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetJson() above, but uses a keep-alive connection from
+    //!  @c pool (and leaves it in @c pool for reuse by later requests).
     //------------------------------------------------------------------------
     bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetJson() above, but with the timeouts in @c options.
+    //!  If a timeout expires, @c getFailure will be
+    //!  @c GetFailure::k_failNumTimeout.  If @c options has a Cache(),
+    //!  the response body is buffered so it can be cached, and the parsed
+    //!  JSON is kept with the cache entry; a response served from the
+    //!  cache (fresh, or after a 304) is not parsed again.  The SAX,
+    //!  projecting and FastJson variants of GetJson() don't use the cache.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetJson() above, but with the timeouts in @c options and
+    //!  a keep-alive connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Fetches the JSON at the given URL @c urlstr and passes it to the
+    //!  SAX handler @c sax as it is parsed, while the response body
+    //!  arrives.  No DOM is built, so callers that only need a few values
+    //!  from a large document can pick them out in @c sax and ignore the
+    //!  rest.  If the JSON is malformed or a member of @c sax returns
+    //!  false, the transfer is abandoned and @c getFailure is set to
+    //!  @c GetFailure::k_failNumJSON.  Returns true on success, false on
+    //!  failure.  If @c urlstr is an https URL, will verify the server's
+    //!  certificate unless @c verifyCertificate is @c false.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
                  GetFailure & getFailure, bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the SAX GetJson() above, but uses a keep-alive
+    //!  connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the SAX GetJson() above, but with the timeouts in
+    //!  @c options.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the SAX GetJson() above, but with the timeouts in
+    //!  @c options and a keep-alive connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Fetches the JSON at the given URL @c urlstr, keeping only the
+    //!  values at the JSON Pointers (RFC 6901) in @c pointers.  On success,
+    //!  @c json holds a document with just those values, at the same
+    //!  locations, so @c json.contains(nlohmann::json::json_pointer(p))
+    //!  tells whether the value at @c p was present.  Everything else is
+    //!  discarded while parsing, without being built into a DOM.  Returns
+    //!  true on success, false on failure.  On failure, @c getFailure can
+    //!  be examined for more information.  If @c urlstr is an https URL,
+    //!  will verify the server's certificate unless @c verifyCertificate
+    //!  is @c false.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the projecting GetJson() above, but uses a keep-alive
+    //!  connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 ConnectionPool & pool, bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the projecting GetJson() above, but with the timeouts in
+    //!  @c options.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the projecting GetJson() above, but with the timeouts in
+    //!  @c options and a keep-alive connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 ConnectionPool & pool, const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Fetches the JSON at the given URL @c urlstr into @c json, which
+    //!  parses it with simdjson if the library was built with it (see
+    //!  FastJson::HaveSimdJson()).  Values are then fetched from @c json
+    //!  by JSON Pointer, and only converted to nlohmann::json on request.
+    //!  @c json can be reused for later requests to avoid reallocating
+    //!  its buffers.  Returns true on success, false on failure.  On
+    //!  failure, @c getFailure can be examined for more information.  If
+    //!  @c urlstr is an https URL, will verify the server's certificate
+    //!  unless @c verifyCertificate is @c false.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the FastJson GetJson() above, but uses a keep-alive
+    //!  connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the FastJson GetJson() above, but with the timeouts in
+    //!  @c options.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the FastJson GetJson() above, but with the timeouts in
+    //!  @c options and a keep-alive connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options,
+                 bool verifyCertificate = true);
+    
+    //------------------------------------------------------------------------
+    //!  Fetches JSON from the given URL @c urlstr and parses it into
+    //!  @c json.  The response and everything in the parsed JSON are
+    //!  allocated from @c resource, so a caller fetching many documents
+    //!  can use a std::pmr::monotonic_buffer_resource and free them all
+    //!  at once with release().  Destroy (or abandon) the PmrJson objects
+    //!  before calling release(), never after.  With @c pool, always uses
+    //!  HTTP/1.1, and Options().Cache() is not used.  As with the other
+    //!  GetJson() variants, the status code is not checked.  Returns true
+    //!  on success, false on failure.  On failure, @c getFailure can be
+    //!  examined for more information.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, PmrJson & json,
+                 std::pmr::memory_resource *resource,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the PmrJson GetJson() above, but uses a keep-alive
+    //!  connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, PmrJson & json,
+                 std::pmr::memory_resource *resource,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options,
+                 bool verifyCertificate = true);
     
     //------------------------------------------------------------------------
     //!  Returns the status code of the given URL @c urlstr.  If we can't
@@ -92,6 +291,30 @@ namespace Dwm {
     //------------------------------------------------------------------------
     int GetStatus(const std::string & urlstr, GetFailure & getFailure,
                   bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetStatus() above, but uses a keep-alive connection from
+    //!  @c pool (and leaves it in @c pool for reuse by later requests).
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & getFailure,
+                  ConnectionPool & pool, bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetStatus() above, but with the timeouts in @c options.
+    //!  If a timeout expires, @c getFailure will be
+    //!  @c GetFailure::k_failNumTimeout.
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & getFailure,
+                  const RequestOptions & options,
+                  bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetStatus() above, but with the timeouts in @c options
+    //!  and a keep-alive connection from @c pool.
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & getFailure,
+                  ConnectionPool & pool, const RequestOptions & options,
+                  bool verifyCertificate = true);
     
     //------------------------------------------------------------------------
     //!  Fetches the web page at the given URL @c urlstr and stores it in
@@ -114,6 +337,162 @@ namespace Dwm {
                      http::response<http::string_body> & response,
                      GetFailure & getFailure, bool verifyCertificate = true);
 
+    //------------------------------------------------------------------------
+    //!  Just like GetResponse() above, but uses a keep-alive connection
+    //!  from @c pool (and leaves it in @c pool for reuse by later requests).
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, ConnectionPool & pool,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetResponse() above, but with the timeouts in
+    //!  @c options.  If a timeout expires, @c getFailure will be
+    //!  @c GetFailure::k_failNumTimeout.
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, const RequestOptions & options,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetResponse() above, but with the timeouts in
+    //!  @c options and a keep-alive connection from @c pool.
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, ConnectionPool & pool,
+                     const RequestOptions & options,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetResponse() above, but the header fields and body of
+    //!  @c response are allocated from the memory resource it was
+    //!  constructed with (see MakePmrResponse()).  Options().Cache() is
+    //!  not used.
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr, PmrResponse & response,
+                     GetFailure & getFailure, const RequestOptions & options,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the PmrResponse GetResponse() above, but uses a
+    //!  keep-alive connection from @c pool.  Always uses HTTP/1.1.
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr, PmrResponse & response,
+                     GetFailure & getFailure, ConnectionPool & pool,
+                     const RequestOptions & options,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the GetJson() taking a string and @c options above, but
+    //!  for a URL that's already been parsed; @c urlView is not parsed
+    //!  again.  Only http and https URLs are accepted.
+    //------------------------------------------------------------------------
+    bool GetJson(const UrlView & urlView, nlohmann::json & json,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetJson() above, but uses a keep-alive connection from
+    //!  @c pool.
+    //------------------------------------------------------------------------
+    bool GetJson(const UrlView & urlView, nlohmann::json & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options,
+                 bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the GetStatus() taking a string and @c options above,
+    //!  but for a URL that's already been parsed.
+    //------------------------------------------------------------------------
+    int GetStatus(const UrlView & urlView, GetFailure & getFailure,
+                  const RequestOptions & options,
+                  bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetStatus() above, but uses a keep-alive connection from
+    //!  @c pool.
+    //------------------------------------------------------------------------
+    int GetStatus(const UrlView & urlView, GetFailure & getFailure,
+                  ConnectionPool & pool, const RequestOptions & options,
+                  bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like the GetResponse() taking a string and @c options above,
+    //!  but for a URL that's already been parsed.
+    //------------------------------------------------------------------------
+    bool GetResponse(const UrlView & urlView,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, const RequestOptions & options,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetResponse() above, but uses a keep-alive connection
+    //!  from @c pool.
+    //------------------------------------------------------------------------
+    bool GetResponse(const UrlView & urlView,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, ConnectionPool & pool,
+                     const RequestOptions & options,
+                     bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Fetches the web page at the given URL @c urlstr without buffering
+    //!  the body: the response header is stored in @c header and the body
+    //!  is passed to @c onBody in chunks (of at most
+    //!  Connection::k_bodyChunkSize bytes) as it arrives.  @c header is
+    //!  filled in before the first call to @c onBody.  A compressed body
+    //!  is decoded before it's passed to @c onBody, and the
+    //!  Content-Encoding and Content-Length are removed from @c header.
+    //!  If @c onBody returns false, the transfer is abandoned.  If
+    //!  @c urlstr is an https URL, will verify the server's certificate
+    //!  unless
+    //!  @c verifyCertificate is @c false.  Returns true on success, false
+    //!  on failure.  On failure, @c getFailure can be examined for more
+    //!  information.
+    //------------------------------------------------------------------------
+    bool GetStream(const std::string & urlstr,
+                   http::response_header<> & header,
+                   const BodyCallback & onBody, GetFailure & getFailure,
+                   bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetStream() above, but with the timeouts in @c options.
+    //------------------------------------------------------------------------
+    bool GetStream(const std::string & urlstr,
+                   http::response_header<> & header,
+                   const BodyCallback & onBody, GetFailure & getFailure,
+                   const RequestOptions & options,
+                   bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Fetches the resource at the given URL @c urlstr into the file at
+    //!  @c path, writing the body to the file as it arrives.  If
+    //!  @c resume is true and the file already exists, only the bytes
+    //!  past the end of the file are requested (with a Range header) and
+    //!  appended; if the server doesn't honor the range, the file is
+    //!  rewritten.  On return, @c stats holds the number of bytes
+    //!  received, the offset we resumed from and the elapsed time.  If
+    //!  @c urlstr is an https URL, will verify the server's certificate
+    //!  unless @c verifyCertificate is @c false.  Returns true on
+    //!  success, false on failure.  On failure, @c getFailure can be
+    //!  examined for more information, and the file may hold a partial
+    //!  body that can be resumed.
+    //------------------------------------------------------------------------
+    bool GetToFile(const std::string & urlstr, const std::string & path,
+                   TransferStats & stats, GetFailure & getFailure,
+                   bool resume = false, bool verifyCertificate = true);
+
+    //------------------------------------------------------------------------
+    //!  Just like GetToFile() above, but with the timeouts in @c options.
+    //------------------------------------------------------------------------
+    bool GetToFile(const std::string & urlstr, const std::string & path,
+                   TransferStats & stats, GetFailure & getFailure,
+                   const RequestOptions & options, bool resume = false,
+                   bool verifyCertificate = true);
+    
   }  // namespace WebUtils
 
 }  // namespace Dwm
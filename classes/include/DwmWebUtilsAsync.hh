@@ -0,0 +1,233 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsAsync.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils asynchronous function declarations
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSASYNC_HH_
+#define _DWMWEBUTILSASYNC_HH_
+
+#include <exception>
+#include <string>
+#include <tuple>
+#include <boost/asio.hpp>
+
+#include "DwmWebUtils.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Implementation details of the Async*() function templates below.
+    //------------------------------------------------------------------------
+    namespace Detail {
+
+      boost::asio::awaitable<std::tuple<GetFailure,
+                                        http::response<http::string_body>>>
+      CoGetResponse(std::string urlstr, RequestOptions options,
+                    bool verifyCertificate);
+
+      boost::asio::awaitable<std::tuple<GetFailure,nlohmann::json>>
+      CoGetJson(std::string urlstr, RequestOptions options,
+                bool verifyCertificate);
+
+      boost::asio::awaitable<std::tuple<GetFailure,int>>
+      CoGetStatus(std::string urlstr, RequestOptions options,
+                  bool verifyCertificate);
+
+      //----------------------------------------------------------------------
+      //!  Spawns @c op on @c ioc and delivers its result to the handler
+      //!  for @c token as (GetFailure, T).
+      //----------------------------------------------------------------------
+      template <typename T, typename CompletionToken>
+      auto Initiate(boost::asio::io_context & ioc,
+                    boost::asio::awaitable<std::tuple<GetFailure,T>> && op,
+                    CompletionToken && token)
+      {
+        return boost::asio::async_initiate<CompletionToken,
+                                           void(GetFailure,T)>
+          ([&ioc] (auto handler,
+                   boost::asio::awaitable<std::tuple<GetFailure,T>> op) {
+            boost::asio::co_spawn(ioc, std::move(op),
+                                  [h = std::move(handler)]
+                                  (std::exception_ptr ep,
+                                   std::tuple<GetFailure,T> result) mutable {
+                                    if (ep) {
+                                      std::get<0>(result).FailNum(GetFailure::k_failNumUnknown);
+                                    }
+                                    std::apply(std::move(h), std::move(result));
+                                  });
+          }, token, std::move(op));
+      }
+      
+    }  // namespace Detail
+    //------------------------------------------------------------------------
+    //!  Asynchronously fetches the web page at the given URL @c urlstr,
+    //!  running on @c ioc.  @c token may be a completion handler with
+    //!  signature void(GetFailure, http::response<http::string_body>),
+    //!  @c boost::asio::use_awaitable (yielding a std::tuple of the same)
+    //!  or @c boost::asio::use_future (likewise, in a std::future).  The
+    //!  GetFailure will be false on success, and
+    //!  @c GetFailure::k_failNumTimeout if one of the timeouts in
+    //!  @c options expired.  If @c urlstr is an https URL, will verify the
+    //!  server's certificate unless @c verifyCertificate is @c false.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetResponse(boost::asio::io_context & ioc,
+                          const std::string & urlstr,
+                          const RequestOptions & options,
+                          bool verifyCertificate, CompletionToken && token)
+    {
+      return Detail::Initiate(ioc,
+                              Detail::CoGetResponse(urlstr, options,
+                                                    verifyCertificate),
+                              std::forward<CompletionToken>(token));
+    }
+
+    //------------------------------------------------------------------------
+    //!  Same as above with default RequestOptions.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetResponse(boost::asio::io_context & ioc,
+                          const std::string & urlstr, bool verifyCertificate,
+                          CompletionToken && token)
+    {
+      return AsyncGetResponse(ioc, urlstr, RequestOptions(),
+                              verifyCertificate,
+                              std::forward<CompletionToken>(token));
+    }
+
+    //------------------------------------------------------------------------
+    //!  Same as above with @c verifyCertificate true.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetResponse(boost::asio::io_context & ioc,
+                          const std::string & urlstr,
+                          CompletionToken && token)
+    {
+      return AsyncGetResponse(ioc, urlstr, true,
+                              std::forward<CompletionToken>(token));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Asynchronously fetches the JSON at the given URL @c urlstr, running
+    //!  on @c ioc.  Completion signature is
+    //!  void(GetFailure, nlohmann::json).  See AsyncGetResponse().
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetJson(boost::asio::io_context & ioc,
+                      const std::string & urlstr,
+                      const RequestOptions & options,
+                      bool verifyCertificate, CompletionToken && token)
+    {
+      return Detail::Initiate(ioc,
+                              Detail::CoGetJson(urlstr, options,
+                                                verifyCertificate),
+                              std::forward<CompletionToken>(token));
+    }
+
+    //------------------------------------------------------------------------
+    //!  Same as above with default RequestOptions.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetJson(boost::asio::io_context & ioc,
+                      const std::string & urlstr, bool verifyCertificate,
+                      CompletionToken && token)
+    {
+      return AsyncGetJson(ioc, urlstr, RequestOptions(), verifyCertificate,
+                          std::forward<CompletionToken>(token));
+    }
+
+    //------------------------------------------------------------------------
+    //!  Same as above with @c verifyCertificate true.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetJson(boost::asio::io_context & ioc,
+                      const std::string & urlstr, CompletionToken && token)
+    {
+      return AsyncGetJson(ioc, urlstr, true,
+                          std::forward<CompletionToken>(token));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Asynchronously fetches the status code of the given URL @c urlstr,
+    //!  running on @c ioc.  Completion signature is void(GetFailure, int);
+    //!  the int is -1 if we couldn't get a status code at all.  See
+    //!  AsyncGetResponse().
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetStatus(boost::asio::io_context & ioc,
+                        const std::string & urlstr,
+                        const RequestOptions & options,
+                        bool verifyCertificate, CompletionToken && token)
+    {
+      return Detail::Initiate(ioc,
+                              Detail::CoGetStatus(urlstr, options,
+                                                  verifyCertificate),
+                              std::forward<CompletionToken>(token));
+    }
+
+    //------------------------------------------------------------------------
+    //!  Same as above with default RequestOptions.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetStatus(boost::asio::io_context & ioc,
+                        const std::string & urlstr, bool verifyCertificate,
+                        CompletionToken && token)
+    {
+      return AsyncGetStatus(ioc, urlstr, RequestOptions(), verifyCertificate,
+                            std::forward<CompletionToken>(token));
+    }
+
+    //------------------------------------------------------------------------
+    //!  Same as above with @c verifyCertificate true.
+    //------------------------------------------------------------------------
+    template <typename CompletionToken>
+    auto AsyncGetStatus(boost::asio::io_context & ioc,
+                        const std::string & urlstr, CompletionToken && token)
+    {
+      return AsyncGetStatus(ioc, urlstr, true,
+                            std::forward<CompletionToken>(token));
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSASYNC_HH_
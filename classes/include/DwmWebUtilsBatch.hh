@@ -0,0 +1,184 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsBatch.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils batch fetch declarations
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSBATCH_HH_
+#define _DWMWEBUTILSBATCH_HH_
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DwmWebUtils.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Options for GetStatusMany() and GetJsonMany().
+    //------------------------------------------------------------------------
+    class BatchOptions
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Default constructor: at most 64 requests in flight, at most 6
+      //!  per host, no deadline, verify server certificates.
+      //----------------------------------------------------------------------
+      BatchOptions() = default;
+
+      //----------------------------------------------------------------------
+      //!  Returns the maximum number of requests in flight.
+      //----------------------------------------------------------------------
+      size_t MaxConcurrent() const
+      { return _maxConcurrent; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the maximum number of requests in flight.
+      //----------------------------------------------------------------------
+      size_t MaxConcurrent(size_t maxConcurrent)
+      { return _maxConcurrent = (maxConcurrent ? maxConcurrent : 1); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the maximum number of requests in flight to a single
+      //!  host (scheme, host and port).
+      //----------------------------------------------------------------------
+      size_t MaxPerHost() const
+      { return _maxPerHost; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the maximum number of requests in flight to a
+      //!  single host (scheme, host and port).
+      //----------------------------------------------------------------------
+      size_t MaxPerHost(size_t maxPerHost)
+      { return _maxPerHost = (maxPerHost ? maxPerHost : 1); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the deadline for the whole batch, relative to the start
+      //!  of the batch.  Zero means no deadline.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds Deadline() const
+      { return _deadline; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the deadline for the whole batch.  Requests
+      //!  still in flight when the deadline passes are cancelled, and
+      //!  requests not yet started are not attempted.  Both fail with
+      //!  @c GetFailure::k_failNumTimeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds Deadline(std::chrono::milliseconds deadline)
+      { return _deadline = deadline; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if server certificates will be verified for https
+      //!  URLs.
+      //----------------------------------------------------------------------
+      bool VerifyCertificate() const
+      { return _verifyCertificate; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns whether or not server certificates will be
+      //!  verified for https URLs.
+      //----------------------------------------------------------------------
+      bool VerifyCertificate(bool verifyCertificate)
+      { return _verifyCertificate = verifyCertificate; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the options (timeouts) applied to each request.
+      //----------------------------------------------------------------------
+      const RequestOptions & Request() const
+      { return _request; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the options (timeouts) applied to each request.
+      //----------------------------------------------------------------------
+      const RequestOptions & Request(const RequestOptions & request)
+      { return _request = request; }
+      
+    private:
+      size_t                     _maxConcurrent = 64;
+      size_t                     _maxPerHost = 6;
+      std::chrono::milliseconds  _deadline = std::chrono::milliseconds(0);
+      bool                       _verifyCertificate = true;
+      RequestOptions             _request;
+    };
+
+    //------------------------------------------------------------------------
+    //!  Fetches the status code of each of the given @c urls concurrently
+    //!  (from a single thread), within the limits of @c options.  Returns
+    //!  a vector with one entry per URL, in the same order as @c urls.
+    //!  Each entry holds the GetFailure and status code for the URL; the
+    //!  status code is -1 if we couldn't get one.  Requests to the same
+    //!  host reuse keep-alive connections where possible.
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,int>>
+    GetStatusMany(const std::vector<std::string> & urls,
+                  const BatchOptions & options = BatchOptions());
+
+    //------------------------------------------------------------------------
+    //!  Same as above, for URLs that have already been parsed.
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,int>>
+    GetStatusMany(const std::vector<Url> & urls,
+                  const BatchOptions & options = BatchOptions());
+
+    //------------------------------------------------------------------------
+    //!  Fetches the JSON at each of the given @c urls concurrently (from a
+    //!  single thread), within the limits of @c options.  Returns a vector
+    //!  with one entry per URL, in the same order as @c urls.  Each entry
+    //!  holds the GetFailure and JSON for the URL.
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,nlohmann::json>>
+    GetJsonMany(const std::vector<std::string> & urls,
+                const BatchOptions & options = BatchOptions());
+
+    //------------------------------------------------------------------------
+    //!  Same as above, for URLs that have already been parsed.
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,nlohmann::json>>
+    GetJsonMany(const std::vector<Url> & urls,
+                const BatchOptions & options = BatchOptions());
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSBATCH_HH_
@@ -0,0 +1,554 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsConnection.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ConnectionKey and Dwm::WebUtils::Connection
+//!  class declarations
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSCONNECTION_HH_
+#define _DWMWEBUTILSCONNECTION_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <boost/version.hpp>
+#if (BOOST_VERSION < 108000)
+  #define BOOST_BEAST_USE_STD_STRING_VIEW // deprecated with newer boost
+#endif
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast.hpp>
+#include <boost/beast/ssl.hpp>
+
+#include "DwmWebUtilsGetFailure.hh"
+#include "DwmWebUtilsPmr.hh"
+#include "DwmWebUtilsRequestMetrics.hh"
+#include "DwmWebUtilsRequestOptions.hh"
+#include "DwmWebUtilsResponseCache.hh"
+#include "DwmWebUtilsTransferStats.hh"
+#include "DwmWebUtilsUrl.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace http = boost::beast::http;
+
+    //------------------------------------------------------------------------
+    //!  Receives a response body incrementally, one chunk at a time.  The
+    //!  chunk is only valid for the duration of the call.  Return false
+    //!  to abandon the request.
+    //------------------------------------------------------------------------
+    using BodyCallback = std::function<bool(std::string_view chunk)>;
+
+    //------------------------------------------------------------------------
+    //!  Reads a response body from @c body, which pulls more of the body
+    //!  from the connection as it is consumed.  Returns true if the body
+    //!  was acceptable, false to abandon the request.
+    //------------------------------------------------------------------------
+    using BodyReader = std::function<bool(std::istream & body)>;
+
+    class RequestContext;
+    
+    //------------------------------------------------------------------------
+    //!  Identifies the remote end of a Connection: the scheme, host and
+    //!  port, and whether or not the server's certificate is verified
+    //!  (only relevant for https).  Used as the key for pooled connections.
+    //------------------------------------------------------------------------
+    class ConnectionKey
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      ConnectionKey() = default;
+
+      //----------------------------------------------------------------------
+      //!  Construct from the scheme, host and port of @c url.
+      //----------------------------------------------------------------------
+      ConnectionKey(const Url & url, bool verifyCertificate);
+
+      //----------------------------------------------------------------------
+      //!  Sets the key from the scheme, host and port of @c url, reusing
+      //!  our string storage.  Returns a reference to the key.
+      //----------------------------------------------------------------------
+      ConnectionKey & Assign(const Url & url, bool verifyCertificate);
+
+      //----------------------------------------------------------------------
+      //!  Returns the scheme ("http" or "https").
+      //----------------------------------------------------------------------
+      const std::string & Scheme() const
+      { return _scheme; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the host.
+      //----------------------------------------------------------------------
+      const std::string & Host() const
+      { return _host; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the port.
+      //----------------------------------------------------------------------
+      uint16_t Port() const
+      { return _port; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the server's certificate is verified.
+      //----------------------------------------------------------------------
+      bool VerifyCertificate() const
+      { return _verifyCertificate; }
+
+      //----------------------------------------------------------------------
+      //!  Less-than operator, so we can be used as a key in ordered
+      //!  containers.
+      //----------------------------------------------------------------------
+      bool operator < (const ConnectionKey & key) const;
+
+      //----------------------------------------------------------------------
+      //!  Equality operator
+      //----------------------------------------------------------------------
+      bool operator == (const ConnectionKey & key) const;
+
+    private:
+      std::string  _scheme;
+      std::string  _host;
+      uint16_t     _port = 0;
+      bool         _verifyCertificate = true;
+    };
+
+    //------------------------------------------------------------------------
+    //!  Encapsulates an http or https connection to a single host, which
+    //!  may be used for multiple GET requests if the server permits it.
+    //!  All I/O is done with coroutines (the Async*() members), which run
+    //!  on the connection's executor.  A connection constructed without
+    //!  an executor has its own io_context, and its synchronous members
+    //!  (Open(), Get(), Close()) run the coroutines to completion on it.
+    //!  So such a connection may be used from any thread, but only from
+    //!  one thread at a time.
+    //------------------------------------------------------------------------
+    class Connection
+    {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      //----------------------------------------------------------------------
+      //!  The size of the buffer used by the streaming Get().
+      //----------------------------------------------------------------------
+      static constexpr size_t  k_bodyChunkSize = 64 * 1024;
+
+      //----------------------------------------------------------------------
+      //!  The most requests GetPipelined() will have outstanding at once.
+      //----------------------------------------------------------------------
+      static constexpr size_t  k_maxPipelineDepth = 16;
+
+      //----------------------------------------------------------------------
+      //!  Constructs an unopened connection for @c key, with its own
+      //!  io_context for synchronous use.
+      //----------------------------------------------------------------------
+      Connection(const ConnectionKey & key);
+
+      //----------------------------------------------------------------------
+      //!  Constructs an unopened connection for @c key whose I/O will run
+      //!  on @c executor.  Only the Async*() members may be used, from
+      //!  coroutines running on @c executor.
+      //----------------------------------------------------------------------
+      Connection(const ConnectionKey & key,
+                 const boost::asio::any_io_executor & executor);
+
+      Connection(const Connection &) = delete;
+      Connection & operator = (const Connection &) = delete;
+
+      //----------------------------------------------------------------------
+      //!  Destructor.  Closes the connection if it's open.
+      //----------------------------------------------------------------------
+      ~Connection();
+
+      //----------------------------------------------------------------------
+      //!  Returns the key (scheme, host, port and certificate verification)
+      //!  of the connection.
+      //----------------------------------------------------------------------
+      const ConnectionKey & Key() const
+      { return _key; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the options (timeouts) used for subsequent requests.
+      //----------------------------------------------------------------------
+      const RequestOptions & Options() const
+      { return _options; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the options (timeouts) used for subsequent
+      //!  requests.
+      //----------------------------------------------------------------------
+      const RequestOptions & Options(const RequestOptions & options)
+      { return _options = options; }
+
+      //----------------------------------------------------------------------
+      //!  Connects to the host and port of the connection's key and, if the
+      //!  scheme is https, performs the TLS handshake.  Returns true on
+      //!  success.  On failure, returns false and sets @c failure to
+      //!  @c GetFailure::k_failNumConnect, @c GetFailure::k_failNumAuth or
+      //!  @c GetFailure::k_failNumTimeout.  The connect, handshake and
+      //!  total timeouts from Options() apply.
+      //----------------------------------------------------------------------
+      bool Open(GetFailure & failure);
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of Open().
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<bool> AsyncOpen(GetFailure & failure);
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if the connection is open.
+      //----------------------------------------------------------------------
+      bool IsOpen() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the address and port of the server, or a
+      //!  default-constructed endpoint if the connection isn't open.
+      //----------------------------------------------------------------------
+      boost::asio::ip::tcp::endpoint RemoteEndpoint() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the connection is open but idle and the socket is
+      //!  readable, which means the server closed the connection (or sent
+      //!  data we did not ask for).  Either way the connection can't be
+      //!  reused.
+      //----------------------------------------------------------------------
+      bool IsStale();
+
+      //----------------------------------------------------------------------
+      //!  Closes the connection.  For an https connection without its own
+      //!  io_context, this does not do a TLS shutdown; use AsyncClose()
+      //!  for that.
+      //----------------------------------------------------------------------
+      void Close();
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of Close().  Performs the TLS shutdown for an
+      //!  https connection.
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<void> AsyncClose();
+      
+      //----------------------------------------------------------------------
+      //!  Cancels any outstanding asynchronous operations on the connection
+      //!  (they will fail), and causes subsequent AsyncOpen() and AsyncGet()
+      //!  calls to fail.  Must be called from the connection's executor.
+      //----------------------------------------------------------------------
+      void Cancel();
+      
+      //----------------------------------------------------------------------
+      //!  Sends a GET request for @c url and reads the response into
+      //!  @c response.  If @c keepAlive is true, asks the server to keep
+      //!  the connection open after the response.  If the connection was
+      //!  previously used and the request fails before any part of the
+      //!  response is received (the server closed an idle connection),
+      //!  the connection is reopened and the request is retried once.
+      //!  The timeouts from Options() apply, with the total timeout
+      //!  covering any connecting and retrying.  If Options() has a
+      //!  Cache(), a fresh cached response is returned without sending a
+      //!  request, a stale one is revalidated (a 304 reply is replaced
+      //!  with the cached response), and the cache is updated with the
+      //!  response.  Unless Options().Compression() is false, we ask for
+      //!  a compressed response; a body with a Content-Encoding we
+      //!  support is decoded (and the Content-Encoding removed) before we
+      //!  return.  Returns true on success, false on failure.  On
+      //!  failure, @c failure can be examined for more information.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response<http::string_body> & response,
+               GetFailure & failure, bool keepAlive);
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of Get().
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<bool>
+      AsyncGet(const Url & url, http::response<http::string_body> & response,
+               GetFailure & failure, bool keepAlive);
+      
+      //----------------------------------------------------------------------
+      //!  Just like Get() above, but the header fields and body of the
+      //!  response are allocated from the memory resource @c response was
+      //!  constructed with (see MakePmrResponse()).  Options().Cache() is
+      //!  not used.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, PmrResponse & response, GetFailure & failure,
+               bool keepAlive);
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of Get(const Url &, PmrResponse &, ...).
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<bool>
+      AsyncGet(const Url & url, PmrResponse & response, GetFailure & failure,
+               bool keepAlive);
+      
+      //----------------------------------------------------------------------
+      //!  Just like Get() above, but uses (and leaves the response in)
+      //!  @c context instead of allocating a new request, response and
+      //!  buffers, so that repeated requests on an open connection make
+      //!  no heap allocations.  Options().Cache() is not used.  Only for
+      //!  connections constructed with their own io_context.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, RequestContext & context,
+               GetFailure & failure, bool keepAlive);
+      
+      //----------------------------------------------------------------------
+      //!  Fetches each of @c urls, which must all have the scheme, host
+      //!  and port of Key(), with HTTP/1.1 pipelining: requests are
+      //!  written back-to-back (up to k_maxPipelineDepth outstanding)
+      //!  without waiting for responses, and the responses are read in
+      //!  order.  @c responses and @c failures are resized to match
+      //!  @c urls, and entry i holds the result for @c urls[i], just as
+      //!  if it had been fetched with Get().  If the server closes the
+      //!  connection before answering every request (or says it will),
+      //!  the unanswered requests are sent one at a time instead, on new
+      //!  connections as needed.  @c keepAlive applies to the last
+      //!  request.  The idle read timeout from Options() applies to each
+      //!  response, and the total timeout to the whole batch.  Options()
+      //!  Cache() and Compression() are honored as for Get().  Returns
+      //!  true if every request succeeded.
+      //----------------------------------------------------------------------
+      bool GetPipelined(const std::vector<Url> & urls,
+                        std::vector<http::response<http::string_body>>
+                        & responses, std::vector<GetFailure> & failures,
+                        bool keepAlive);
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of GetPipelined().
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<bool>
+      AsyncGetPipelined(const std::vector<Url> & urls,
+                        std::vector<http::response<http::string_body>>
+                        & responses, std::vector<GetFailure> & failures,
+                        bool keepAlive);
+      
+      //----------------------------------------------------------------------
+      //!  Just like Get() above, but instead of buffering the response
+      //!  body, passes it to @c onBody in chunks of at most
+      //!  k_bodyChunkSize bytes as it arrives, so memory use does not
+      //!  depend on the size of the body (and there is no body size
+      //!  limit).  @c header is filled in before the first call to
+      //!  @c onBody, so the callback may examine it.  If @c onBody
+      //!  returns false, the connection is closed and we return false
+      //!  with @c failure set to @c GetFailure::k_failNumGet.  A body
+      //!  with a Content-Encoding we support is decoded as it arrives
+      //!  (see ContentDecoder); @c header then has no Content-Encoding
+      //!  or Content-Length, and corrupt or truncated encoded content
+      //!  fails with @c GetFailure::k_failNumGet.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response_header<> & header,
+               const BodyCallback & onBody, GetFailure & failure,
+               bool keepAlive);
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of the streaming Get().
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<bool>
+      AsyncGet(const Url & url, http::response_header<> & header,
+               const BodyCallback & onBody, GetFailure & failure,
+               bool keepAlive);
+
+      //----------------------------------------------------------------------
+      //!  Just like Get() above, but passes the response body to @c reader
+      //!  as a std::istream.  Reading from the stream reads from the
+      //!  connection, so a parser can consume the body while it arrives
+      //!  without the body being buffered in full.  @c header is filled
+      //!  in once the first read from the stream returns.  If @c reader
+      //!  returns true without reading all of the body, the rest is read
+      //!  and discarded.  If @c reader returns false, the rest of the
+      //!  response is abandoned and we return false; unless the request
+      //!  had already failed, @c failure is left as @c reader set it (or
+      //!  set to @c GetFailure::k_failNumGet if @c reader didn't set it).
+      //!  Only for connections constructed with their own io_context.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response_header<> & header,
+               const BodyReader & reader, GetFailure & failure,
+               bool keepAlive);
+      
+      //----------------------------------------------------------------------
+      //!  Sends a GET request for @c url and writes the response body
+      //!  directly to the file at @c path, without buffering it in
+      //!  memory.  If @c resume is true and the file exists, asks the
+      //!  server for only the bytes past the end of the file and appends
+      //!  them.  If the server ignores the range and sends the whole
+      //!  body, the file is rewritten from the start.  If the server says
+      //!  the file is already complete, no bytes are transferred and we
+      //!  return true.  Fills in @c stats.  Returns true on success,
+      //!  false on failure.  On failure, @c failure can be examined for
+      //!  more information; a failure to open or write the file is
+      //!  reported as @c GetFailure::k_failNumUnknown.
+      //----------------------------------------------------------------------
+      bool GetToFile(const Url & url, const std::string & path, bool resume,
+                     TransferStats & stats, GetFailure & failure,
+                     bool keepAlive);
+
+      //----------------------------------------------------------------------
+      //!  Coroutine version of GetToFile().
+      //----------------------------------------------------------------------
+      boost::asio::awaitable<bool>
+      AsyncGetToFile(const Url & url, const std::string & path, bool resume,
+                     TransferStats & stats, GetFailure & failure,
+                     bool keepAlive);
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if the connection is open and the last response
+      //!  permits another request on the connection.
+      //----------------------------------------------------------------------
+      bool Reusable() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of requests completed on the connection.
+      //----------------------------------------------------------------------
+      uint64_t Requests() const
+      { return _requests; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time at which the connection was last used.
+      //----------------------------------------------------------------------
+      Clock::time_point LastUsed() const
+      { return _lastUsed; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the application protocol negotiated with ALPN during
+      //!  the TLS handshake ("http/1.1" or "h2"), or an empty string if
+      //!  none was negotiated (or the scheme is http).
+      //----------------------------------------------------------------------
+      const std::string & Protocol() const
+      { return _protocol; }
+      
+    private:
+      friend class Http2Session;
+      
+      using tcp = boost::asio::ip::tcp;
+      using SslStream = boost::asio::ssl::stream<boost::beast::tcp_stream>;
+      using CacheEntries =
+        std::vector<std::shared_ptr<const ResponseCache::Entry>>;
+      struct ConnectRace;
+
+      ConnectionKey                                 _key;
+      RequestOptions                                _options;
+      Clock::time_point                             _deadline;
+      std::unique_ptr<boost::asio::io_context>      _ioc;
+      boost::asio::any_io_executor                  _executor;
+      tcp::resolver                                 _resolver;
+      std::shared_ptr<ConnectRace>                  _race;
+      std::shared_ptr<boost::asio::ssl::context>    _sslContext;
+      std::unique_ptr<boost::beast::tcp_stream>     _httpStream;
+      std::unique_ptr<SslStream>                    _httpsStream;
+      bool                                          _keepAlive;
+      bool                                          _cancelled;
+      uint64_t                                      _requests;
+      Clock::time_point                             _lastUsed;
+      bool                                          _offerHttp2;
+      std::string                                   _protocol;
+      boost::asio::steady_timer                     _timer;
+
+      Clock::time_point Expiry(std::chrono::milliseconds timeout) const;
+      boost::asio::awaitable<bool> AsyncConnect(GetFailure & failure);
+      boost::asio::awaitable<tcp::resolver::results_type>
+      AsyncResolve(Clock::time_point expiry, boost::system::error_code & ec);
+      boost::asio::awaitable<std::unique_ptr<tcp::socket>>
+      AsyncConnectRace(const tcp::resolver::results_type & results,
+                       Clock::time_point expiry,
+                       boost::system::error_code & ec);
+      boost::asio::awaitable<bool> AsyncOpenHttp(GetFailure & failure);
+      boost::asio::awaitable<bool> AsyncOpenHttps(GetFailure & failure);
+      int NativeHandle();
+      RequestMetrics *BeginMetrics();
+
+      template <typename F>
+      boost::asio::awaitable<bool>
+      AsyncRequest(const Url & url, GetFailure & failure, F send);
+
+      template <typename F>
+      boost::asio::awaitable<bool>
+      AsyncDispatch(F & send, GetFailure & failure, bool & gotSome);
+      
+      template <typename T, typename Body, typename Fields>
+      boost::asio::awaitable<bool>
+      AsyncSend(T & stream, const Url & url,
+                http::response<Body,Fields> & response,
+                const ResponseCache::Entry * cached,
+                GetFailure & failure, bool keepAlive, bool & gotSome);
+
+      template <typename T>
+      boost::asio::awaitable<bool>
+      AsyncSend(T & stream, const Url & url,
+                http::response_header<> & header,
+                const BodyCallback & onBody, GetFailure & failure,
+                bool keepAlive, bool & gotSome);
+
+      template <typename T>
+      boost::asio::awaitable<bool>
+      AsyncSend(T & stream, const Url & url, const std::string & path,
+                bool resume, TransferStats & stats, GetFailure & failure,
+                bool keepAlive, bool & gotSome);
+
+      template <typename T>
+      boost::asio::awaitable<bool>
+      AsyncSendPipelined(T & stream, const std::vector<Url> & urls,
+                         const std::vector<size_t> & pending,
+                         const CacheEntries & cached,
+                         std::vector<http::response<http::string_body>>
+                         & responses, std::vector<GetFailure> & failures,
+                         bool keepAlive, size_t & resolved, bool & gotSome);
+
+      template <typename T>
+      bool Exchange(T & stream, const Url & url, RequestContext & context,
+                    GetFailure & failure, bool keepAlive, bool & gotSome);
+
+      template <typename T, typename Start>
+      boost::system::error_code
+      RunWithTimeout(T & stream, RequestContext & context,
+                     Clock::time_point expiry, Start start, size_t & bytes);
+      
+      template <typename T>
+      T Run(boost::asio::awaitable<T> && op, GetFailure & failure);
+      
+      void Run(boost::asio::awaitable<void> && op);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSCONNECTION_HH_
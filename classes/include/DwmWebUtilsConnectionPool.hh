@@ -0,0 +1,222 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsConnectionPool.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ConnectionPool class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSCONNECTIONPOOL_HH_
+#define _DWMWEBUTILSCONNECTIONPOOL_HH_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "DwmWebUtilsConnection.hh"
+#include "DwmWebUtilsHttp2Session.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  A thread-safe pool of keep-alive connections, keyed by scheme,
+    //!  host, port and certificate verification.  Idle connections are
+    //!  reused by subsequent requests to the same key, so repeated GETs
+    //!  to the same host don't pay for a new TCP connection (and TLS
+    //!  handshake) every time.  Idle connections are discarded after
+    //!  IdleTimeout(), and no more than MaxPerHost() connections (idle
+    //!  plus in use) will exist for a single key.
+    //!
+    //!  If RequestOptions::Http2() is true for an https request, the pool
+    //!  instead keeps a single Http2Session for the key and multiplexes
+    //!  all such requests on it.  Servers that don't negotiate HTTP/2 are
+    //!  remembered and get pooled HTTP/1.1 connections.
+    //------------------------------------------------------------------------
+    class ConnectionPool
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Constructor
+      //----------------------------------------------------------------------
+      ConnectionPool(size_t maxPerHost = 4,
+                     std::chrono::milliseconds idleTimeout =
+                     std::chrono::seconds(30));
+
+      ConnectionPool(const ConnectionPool &) = delete;
+      ConnectionPool & operator = (const ConnectionPool &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Destructor.  Closes all idle connections.
+      //----------------------------------------------------------------------
+      ~ConnectionPool();
+
+      //----------------------------------------------------------------------
+      //!  Returns the maximum number of connections per key.
+      //----------------------------------------------------------------------
+      size_t MaxPerHost() const;
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the maximum number of connections per key.
+      //----------------------------------------------------------------------
+      size_t MaxPerHost(size_t maxPerHost);
+
+      //----------------------------------------------------------------------
+      //!  Returns the idle timeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds IdleTimeout() const;
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the idle timeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds
+      IdleTimeout(std::chrono::milliseconds idleTimeout);
+
+      //----------------------------------------------------------------------
+      //!  Fetches @c url using a pooled connection, storing the response in
+      //!  @c response.  Returns true on success, false on failure.  On
+      //!  failure, @c failure can be examined for more information.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response<http::string_body> & response,
+               GetFailure & failure, bool verifyCertificate = true);
+
+      //----------------------------------------------------------------------
+      //!  Just like Get() above, but with the timeouts in @c options.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response<http::string_body> & response,
+               GetFailure & failure, const RequestOptions & options,
+               bool verifyCertificate = true);
+
+      //----------------------------------------------------------------------
+      //!  Just like Get() above, but the response's header fields and body
+      //!  are allocated from the memory resource @c response was
+      //!  constructed with (see MakePmrResponse()).  Always uses HTTP/1.1,
+      //!  and Options().Cache() is not used.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, PmrResponse & response, GetFailure & failure,
+               const RequestOptions & options, bool verifyCertificate = true);
+
+      //----------------------------------------------------------------------
+      //!  Fetches @c url using a pooled connection, passing the response
+      //!  body to @c reader as it arrives (see the BodyReader flavor of
+      //!  Connection::Get()).  Returns true on success, false on failure.
+      //!  On failure, @c failure can be examined for more information.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response_header<> & header,
+               const BodyReader & reader, GetFailure & failure,
+               const RequestOptions & options,
+               bool verifyCertificate = true);
+
+      //----------------------------------------------------------------------
+      //!  Fetches @c url using a pooled HTTP/1.1 connection and @c context
+      //!  (see the RequestContext flavor of Connection::Get()).  The
+      //!  response is left in context.Response().  Once a connection to
+      //!  the host is pooled and @c context has seen a response of similar
+      //!  size, this makes no heap allocations.  Options().Http2() and
+      //!  Options().Cache() are not used.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, RequestContext & context,
+               GetFailure & failure, const RequestOptions & options,
+               bool verifyCertificate = true);
+
+      //----------------------------------------------------------------------
+      //!  Returns a connection for @c key.  This will be an idle pooled
+      //!  connection if one is available, else a new (unopened)
+      //!  connection.  If MaxPerHost() connections for @c key are already
+      //!  in use, blocks until one is returned.  The connection must be
+      //!  given back with Return() when the caller is done with it.
+      //----------------------------------------------------------------------
+      std::unique_ptr<Connection> Checkout(const ConnectionKey & key);
+
+      //----------------------------------------------------------------------
+      //!  Returns a connection previously obtained from Checkout().  If the
+      //!  connection is reusable, it becomes idle in the pool.  Else it is
+      //!  closed and discarded.
+      //----------------------------------------------------------------------
+      void Return(std::unique_ptr<Connection> connection);
+
+      //----------------------------------------------------------------------
+      //!  Closes and discards idle connections that have exceeded the idle
+      //!  timeout.
+      //----------------------------------------------------------------------
+      void Prune();
+
+      //----------------------------------------------------------------------
+      //!  Closes and discards all idle connections.
+      //----------------------------------------------------------------------
+      void Clear();
+      
+      //----------------------------------------------------------------------
+      //!  Returns the number of idle connections in the pool.
+      //----------------------------------------------------------------------
+      size_t IdleConnections() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of HTTP/2 sessions in the pool.
+      //----------------------------------------------------------------------
+      size_t Http2Sessions() const;
+      
+    private:
+      using ConnectionList = std::deque<std::unique_ptr<Connection>>;
+      using Discards = std::vector<std::unique_ptr<Connection>>;
+      
+      mutable std::mutex                     _mtx;
+      std::condition_variable                _cv;
+      size_t                                 _maxPerHost;
+      std::chrono::milliseconds              _idleTimeout;
+      std::map<ConnectionKey,ConnectionList> _idle;
+      std::map<ConnectionKey,size_t>         _inUse;
+      std::map<ConnectionKey,std::shared_ptr<Http2Session>>  _http2;
+      std::set<ConnectionKey>                _http1Only;
+
+      void Prune(ConnectionList & connections, Discards & expired);
+      std::shared_ptr<Http2Session>
+      Http2SessionFor(const ConnectionKey & key,
+                      const RequestOptions & options, GetFailure & failure,
+                      bool & useHttp1);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSCONNECTIONPOOL_HH_
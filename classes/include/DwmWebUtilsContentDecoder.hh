@@ -0,0 +1,137 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsContentDecoder.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ContentDecoder class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSCONTENTDECODER_HH_
+#define _DWMWEBUTILSCONTENTDECODER_HH_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Streaming decoder for HTTP content codings (gzip, deflate and,
+    //!  if the library was built with brotli, br).  Compressed data is
+    //!  passed to Decode() in whatever pieces it arrives in, and the
+    //!  decoded data is passed to an output callback in pieces of at
+    //!  most k_outputSize bytes, so memory use does not depend on the
+    //!  size of the content.
+    //------------------------------------------------------------------------
+    class ContentDecoder
+    {
+    public:
+      using Output = std::function<bool(std::string_view decoded)>;
+
+      //----------------------------------------------------------------------
+      //!  The largest piece of decoded data passed to an Output.
+      //----------------------------------------------------------------------
+      static constexpr size_t  k_outputSize = 64 * 1024;
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if the library was built with brotli.
+      //----------------------------------------------------------------------
+      static bool HaveBrotli();
+
+      //----------------------------------------------------------------------
+      //!  Returns the value we send in Accept-Encoding: the codings we
+      //!  can decode.
+      //----------------------------------------------------------------------
+      static const std::string & AcceptEncoding();
+
+      //----------------------------------------------------------------------
+      //!  Constructor
+      //----------------------------------------------------------------------
+      ContentDecoder();
+
+      ContentDecoder(const ContentDecoder &) = delete;
+      ContentDecoder & operator = (const ContentDecoder &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Destructor
+      //----------------------------------------------------------------------
+      ~ContentDecoder();
+
+      //----------------------------------------------------------------------
+      //!  Prepares to decode content with the given Content-Encoding
+      //!  header value.  Returns true if the content needs decoding and
+      //!  we can decode it.  Returns false if @c contentEncoding is empty
+      //!  or "identity" (nothing to do) or names a coding we don't
+      //!  support (or more than one coding); in that case Decode() must
+      //!  not be called.
+      //----------------------------------------------------------------------
+      bool Begin(std::string_view contentEncoding);
+
+      //----------------------------------------------------------------------
+      //!  Decodes @c encoded and passes the result to @c output.  Returns
+      //!  false if the data is corrupt or @c output returns false.
+      //----------------------------------------------------------------------
+      bool Decode(std::string_view encoded, const Output & output);
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the encoded content was complete.  Call after
+      //!  the last Decode() to detect truncated content.
+      //----------------------------------------------------------------------
+      bool End();
+
+      //----------------------------------------------------------------------
+      //!  Decodes all of @c encoded (with the given Content-Encoding) into
+      //!  @c decoded.  Returns true on success, false if the content is
+      //!  corrupt or truncated or Begin(contentEncoding) would return
+      //!  false.
+      //----------------------------------------------------------------------
+      static bool Decode(std::string_view contentEncoding,
+                         std::string_view encoded, std::string & decoded);
+      
+    private:
+      struct Impl;
+      
+      std::unique_ptr<Impl>  _impl;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSCONTENTDECODER_HH_
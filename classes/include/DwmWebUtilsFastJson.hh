@@ -0,0 +1,147 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsFastJson.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::FastJson class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSFASTJSON_HH_
+#define _DWMWEBUTILSFASTJSON_HH_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  A parsed JSON document whose values are fetched on demand by JSON
+    //!  Pointer (RFC 6901).  When the library is built with simdjson
+    //!  (see HaveSimdJson()), parsing only indexes the document and each
+    //!  lookup walks the text, so no DOM is built unless ToJson() is
+    //!  called.  Without simdjson, Parse() builds a nlohmann::json DOM
+    //!  and lookups use it; the interface is the same.
+    //!
+    //!  With simdjson, Parse() checks the document's structure but some
+    //!  errors inside values are only found when the value is fetched.
+    //------------------------------------------------------------------------
+    class FastJson
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  The number of bytes of spare capacity simdjson needs past the
+      //!  end of the JSON text in Buffer().
+      //----------------------------------------------------------------------
+      static const size_t  k_padding;
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if the library was built with simdjson.
+      //----------------------------------------------------------------------
+      static bool HaveSimdJson();
+      
+      //----------------------------------------------------------------------
+      //!  Constructor
+      //----------------------------------------------------------------------
+      FastJson();
+
+      FastJson(const FastJson &) = delete;
+      FastJson & operator = (const FastJson &) = delete;
+
+      //----------------------------------------------------------------------
+      //!  Destructor
+      //----------------------------------------------------------------------
+      ~FastJson();
+
+      //----------------------------------------------------------------------
+      //!  Returns the buffer holding the JSON text.  Callers reading a
+      //!  body can read directly into it and then call Parse(); keeping
+      //!  k_padding bytes of spare capacity avoids a copy in Parse().
+      //----------------------------------------------------------------------
+      std::string & Buffer()
+      { return _buffer; }
+
+      //----------------------------------------------------------------------
+      //!  Parses the JSON text in Buffer().  Returns true on success.
+      //----------------------------------------------------------------------
+      bool Parse();
+
+      //----------------------------------------------------------------------
+      //!  Copies @c json into Buffer() and parses it.  Returns true on
+      //!  success.
+      //----------------------------------------------------------------------
+      bool Parse(std::string_view json);
+
+      //----------------------------------------------------------------------
+      //!  Fetches the value at @c pointer into @c value.  Returns true on
+      //!  success, false if there's no such value or it's the wrong type.
+      //----------------------------------------------------------------------
+      bool Get(std::string_view pointer, std::string & value);
+      bool Get(std::string_view pointer, double & value);
+      bool Get(std::string_view pointer, int64_t & value);
+      bool Get(std::string_view pointer, uint64_t & value);
+      bool Get(std::string_view pointer, bool & value);
+
+      //----------------------------------------------------------------------
+      //!  Fetches the value at @c pointer (of any type) into @c value,
+      //!  converting just that value to a nlohmann::json.  Returns true on
+      //!  success.
+      //----------------------------------------------------------------------
+      bool Get(std::string_view pointer, nlohmann::json & value);
+      
+      //----------------------------------------------------------------------
+      //!  Converts the whole document to a nlohmann::json.  Returns true
+      //!  on success.
+      //----------------------------------------------------------------------
+      bool ToJson(nlohmann::json & json);
+      
+    private:
+      struct Impl;
+      
+      std::string            _buffer;
+      std::unique_ptr<Impl>  _impl;
+      bool                   _parsed;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSFASTJSON_HH_
@@ -84,6 +84,10 @@ namespace Dwm {
         //--------------------------------------------------------------------
         e_failTypeJSON,
         //--------------------------------------------------------------------
+        //!  A timeout expired (connect, handshake, read or total).
+        //--------------------------------------------------------------------
+        e_failTypeTimeout,
+        //--------------------------------------------------------------------
         //!  other errors
         //--------------------------------------------------------------------
         e_failTypeOther
@@ -97,6 +101,7 @@ namespace Dwm {
       //!  @c k_failNumAuth indicates failure to validate server certificate
       //!  @c k_failNumGet indicates GET request failure (unknown http header)
       //!  @c k_failNumJSON indicates failure to parse JSON in GET response
+      //!  @c k_failNumTimeout indicates a timeout expired
       //!  @c k_failNumUnknown indicates an unknown failure
       //!
       //!  The range 100 to 999 are reserved for HTTP response codes.
@@ -109,6 +114,7 @@ namespace Dwm {
       static constexpr uint16_t  k_failNumAuth    = 3;
       static constexpr uint16_t  k_failNumGet     = 4;
       static constexpr uint16_t  k_failNumJSON    = 5;
+      static constexpr uint16_t  k_failNumTimeout = 6;
       static constexpr uint16_t  k_failNumUnknown = 0xFFFF;
       
       //----------------------------------------------------------------------
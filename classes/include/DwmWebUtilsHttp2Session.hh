@@ -0,0 +1,168 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsHttp2Session.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::Http2Session class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSHTTP2SESSION_HH_
+#define _DWMWEBUTILSHTTP2SESSION_HH_
+
+#include <memory>
+
+#include "DwmWebUtilsConnection.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  An HTTP/2 connection to a single https host, shared by any number
+    //!  of threads.  Each Get() is sent as a stream on the one TLS
+    //!  connection, so concurrent requests are multiplexed instead of
+    //!  each needing its own connection, and request headers are HPACK
+    //!  compressed.  The session's I/O runs on its own thread.
+    //!
+    //!  HTTP/2 is negotiated with ALPN when the session is opened.  If
+    //!  the server doesn't agree to it, Open() fails and Refused()
+    //!  returns true; the caller should fall back to HTTP/1.1
+    //!  Connections.  ConnectionPool does all of this when
+    //!  RequestOptions::Http2() is true.
+    //!
+    //!  Requires the library to be built with nghttp2; see Supported().
+    //------------------------------------------------------------------------
+    class Http2Session
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Returns true if the library was built with nghttp2.  If not,
+      //!  Open() always fails.
+      //----------------------------------------------------------------------
+      static bool Supported();
+      
+      //----------------------------------------------------------------------
+      //!  Constructs an unopened session for @c key, whose scheme must be
+      //!  https.
+      //----------------------------------------------------------------------
+      Http2Session(const ConnectionKey & key);
+
+      Http2Session(const Http2Session &) = delete;
+      Http2Session & operator = (const Http2Session &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Destructor.  Fails any outstanding requests and closes the
+      //!  connection.
+      //----------------------------------------------------------------------
+      ~Http2Session();
+
+      //----------------------------------------------------------------------
+      //!  Returns the key of the session.
+      //----------------------------------------------------------------------
+      const ConnectionKey & Key() const
+      { return _key; }
+      
+      //----------------------------------------------------------------------
+      //!  Connects (using the connect and handshake timeouts in
+      //!  @c options) and negotiates HTTP/2.  Only the first call does
+      //!  anything; concurrent and later calls wait for and return its
+      //!  result.  Returns true on success.  On failure, @c failure can
+      //!  be examined for more information.
+      //----------------------------------------------------------------------
+      bool Open(const RequestOptions & options, GetFailure & failure);
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the server did not agree to HTTP/2.
+      //----------------------------------------------------------------------
+      bool Refused() const;
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if the session is open and may be used for new
+      //!  requests (the connection hasn't failed and the server hasn't
+      //!  sent GOAWAY).
+      //----------------------------------------------------------------------
+      bool Usable() const;
+      
+      //----------------------------------------------------------------------
+      //!  Just like the buffered Connection::Get(), including use of the
+      //!  response cache in @c options, but sent as a stream on the
+      //!  session.  The idle read and total timeouts in @c options apply
+      //!  to the stream.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response<http::string_body> & response,
+               GetFailure & failure, const RequestOptions & options);
+
+      //----------------------------------------------------------------------
+      //!  Just like the BodyReader flavor of Connection::Get(), but sent
+      //!  as a stream on the session.  The stream's flow control window
+      //!  is only opened as @c reader consumes the body, so a slow reader
+      //!  holds back the server instead of buffering the body.
+      //----------------------------------------------------------------------
+      bool Get(const Url & url, http::response_header<> & header,
+               const BodyReader & reader, GetFailure & failure,
+               const RequestOptions & options);
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of requests in progress.
+      //----------------------------------------------------------------------
+      size_t ActiveStreams() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of requests completed on the session.
+      //----------------------------------------------------------------------
+      uint64_t Requests() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the time at which the session was last used.
+      //----------------------------------------------------------------------
+      Connection::Clock::time_point LastUsed() const;
+      
+    private:
+      struct Impl;
+
+      ConnectionKey          _key;
+      std::unique_ptr<Impl>  _impl;
+
+      static void OfferHttp2(Connection & connection);
+      static boost::asio::ssl::stream<boost::beast::tcp_stream> &
+      HttpsStream(Connection & connection);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSHTTP2SESSION_HH_
@@ -0,0 +1,126 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsJsonProjection.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::JsonProjection class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSJSONPROJECTION_HH_
+#define _DWMWEBUTILSJSONPROJECTION_HH_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  A SAX handler that keeps only the values at a set of JSON Pointers
+    //!  (RFC 6901) and discards everything else as it is parsed.  The
+    //!  result is a document holding just the selected values, at the same
+    //!  locations as in the original document, so they can be fetched with
+    //!  the same pointers.  Subtrees that can't contain a selected value
+    //!  are skipped without being built.
+    //------------------------------------------------------------------------
+    class JsonProjection
+      : public nlohmann::json_sax<nlohmann::json>
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Constructs a projection that keeps the values at @c pointers.
+      //!  Malformed pointers are logged and never match.
+      //----------------------------------------------------------------------
+      JsonProjection(const std::vector<std::string> & pointers);
+
+      //----------------------------------------------------------------------
+      //!  Returns the projected document.  It's null if nothing matched.
+      //----------------------------------------------------------------------
+      nlohmann::json & Result()
+      { return _result; }
+      
+      bool null() override;
+      bool boolean(bool val) override;
+      bool number_integer(number_integer_t val) override;
+      bool number_unsigned(number_unsigned_t val) override;
+      bool number_float(number_float_t val, const string_t & s) override;
+      bool string(string_t & val) override;
+      bool binary(binary_t & val) override;
+      bool start_object(std::size_t elements) override;
+      bool key(string_t & val) override;
+      bool end_object() override;
+      bool start_array(std::size_t elements) override;
+      bool end_array() override;
+      bool parse_error(std::size_t position, const std::string & lastToken,
+                       const nlohmann::detail::exception & ex) override;
+      
+    private:
+      //----------------------------------------------------------------------
+      //!  An object or array on the path to a selected value.
+      //----------------------------------------------------------------------
+      struct Frame
+      {
+        bool         isArray;
+        uint64_t     index;
+        std::string  key;
+      };
+
+      enum class Disposition { e_match, e_descend, e_skip };
+      
+      std::vector<std::vector<std::string>>  _pointers;
+      std::vector<Frame>                     _path;
+      uint64_t                               _skipDepth;
+      std::vector<nlohmann::json *>          _capture;
+      std::string                            _captureKey;
+      nlohmann::json                         _result;
+
+      static bool ParsePointer(const std::string & pointer,
+                               std::vector<std::string> & tokens);
+      Disposition Begin();
+      nlohmann::json & Target();
+      bool Scalar(nlohmann::json && val);
+      bool StartContainer(nlohmann::json && val, bool isArray);
+      bool EndContainer();
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSJSONPROJECTION_HH_
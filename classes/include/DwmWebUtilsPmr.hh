@@ -0,0 +1,233 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsPmr.hh
+//!  \author Daniel W. McRobb
+//!  \brief Response and JSON types that allocate from a caller-supplied
+//!    std::pmr::memory_resource
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSPMR_HH_
+#define _DWMWEBUTILSPMR_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <boost/version.hpp>
+#if (BOOST_VERSION < 108000)
+  #define BOOST_BEAST_USE_STD_STRING_VIEW // deprecated with newer boost
+#endif
+#include <boost/beast.hpp>
+#include <nlohmann/json.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace http = boost::beast::http;
+
+    //------------------------------------------------------------------------
+    //!  Allocates from a std::pmr::memory_resource, like
+    //!  std::pmr::polymorphic_allocator.  Unlike polymorphic_allocator,
+    //!  it's assignable, which beast's basic_fields requires.
+    //------------------------------------------------------------------------
+    template <typename T>
+    class PmrAllocator
+    {
+    public:
+      using value_type = T;
+
+      PmrAllocator() noexcept
+          : _resource(std::pmr::get_default_resource())
+      {}
+      
+      PmrAllocator(std::pmr::memory_resource *resource) noexcept
+          : _resource(resource)
+      {}
+
+      template <typename U>
+      PmrAllocator(const PmrAllocator<U> & a) noexcept
+          : _resource(a.Resource())
+      {}
+
+      T *allocate(size_t n)
+      {
+        return static_cast<T *>(_resource->allocate(n * sizeof(T),
+                                                    alignof(T)));
+      }
+
+      void deallocate(T *p, size_t n) noexcept
+      { _resource->deallocate(p, n * sizeof(T), alignof(T)); }
+
+      std::pmr::memory_resource *Resource() const noexcept
+      { return _resource; }
+      
+      template <typename U>
+      bool operator == (const PmrAllocator<U> & a) const noexcept
+      { return (_resource->is_equal(*a.Resource())); }
+      
+      template <typename U>
+      bool operator != (const PmrAllocator<U> & a) const noexcept
+      { return (! (*this == a)); }
+      
+    private:
+      std::pmr::memory_resource  *_resource;
+    };
+    
+    //------------------------------------------------------------------------
+    //!  An HTTP response whose header fields and body are allocated from
+    //!  a std::pmr::memory_resource.  Construct it with
+    //!  MakePmrResponse().
+    //------------------------------------------------------------------------
+    using PmrFields = http::basic_fields<PmrAllocator<char>>;
+    using PmrStringBody =
+      http::basic_string_body<char, std::char_traits<char>,
+                              std::pmr::polymorphic_allocator<char>>;
+    using PmrResponse = http::response<PmrStringBody,PmrFields>;
+
+    //------------------------------------------------------------------------
+    //!  Returns an empty response that allocates from @c resource.
+    //------------------------------------------------------------------------
+    PmrResponse MakePmrResponse(std::pmr::memory_resource *resource);
+    
+    //------------------------------------------------------------------------
+    //!  Sets the memory resource used by PmrJsonAllocator for the life of
+    //!  the object, in the calling thread.  Scopes may be nested.
+    //------------------------------------------------------------------------
+    class PmrJsonScope
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Constructor
+      //----------------------------------------------------------------------
+      explicit PmrJsonScope(std::pmr::memory_resource *resource);
+
+      PmrJsonScope(const PmrJsonScope &) = delete;
+      PmrJsonScope & operator = (const PmrJsonScope &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Destructor.  Restores the previous resource.
+      //----------------------------------------------------------------------
+      ~PmrJsonScope();
+
+      //----------------------------------------------------------------------
+      //!  Returns the resource of the innermost scope in the calling
+      //!  thread, or std::pmr::get_default_resource() if there is none.
+      //----------------------------------------------------------------------
+      static std::pmr::memory_resource *Current();
+      
+    private:
+      std::pmr::memory_resource  *_prev;
+    };
+    
+    //------------------------------------------------------------------------
+    //!  An allocator for PmrJson.  nlohmann::basic_json default-constructs
+    //!  its allocators where it needs them, so this one can't carry a
+    //!  resource from the caller.  Instead it allocates from
+    //!  PmrJsonScope::Current(), and stores the resource in front of each
+    //!  block so the block is returned to the right resource no matter
+    //!  where (or in which scope) it's freed.
+    //------------------------------------------------------------------------
+    template <typename T>
+    class PmrJsonAllocator
+    {
+    public:
+      using value_type = T;
+      using is_always_equal = std::true_type;
+
+      PmrJsonAllocator() noexcept = default;
+
+      template <typename U>
+      PmrJsonAllocator(const PmrJsonAllocator<U> &) noexcept
+      {}
+
+      T *allocate(size_t n)
+      {
+        auto  resource = PmrJsonScope::Current();
+        char  *p = static_cast<char *>(resource->allocate(n * sizeof(T)
+                                                          + k_prefix,
+                                                          k_align));
+        *reinterpret_cast<std::pmr::memory_resource **>(p) = resource;
+        return reinterpret_cast<T *>(p + k_prefix);
+      }
+
+      void deallocate(T *p, size_t n) noexcept
+      {
+        char  *block = reinterpret_cast<char *>(p) - k_prefix;
+        auto  resource =
+          *reinterpret_cast<std::pmr::memory_resource **>(block);
+        resource->deallocate(block, n * sizeof(T) + k_prefix, k_align);
+      }
+
+      template <typename U>
+      bool operator == (const PmrJsonAllocator<U> &) const noexcept
+      { return true; }
+      
+      template <typename U>
+      bool operator != (const PmrJsonAllocator<U> &) const noexcept
+      { return false; }
+      
+    private:
+      static constexpr size_t  k_align =
+        std::max(alignof(T), alignof(std::max_align_t));
+      static constexpr size_t  k_prefix =
+        std::max(k_align, sizeof(std::pmr::memory_resource *));
+    };
+
+    //------------------------------------------------------------------------
+    //!  JSON whose values, strings and containers are allocated from the
+    //!  resource of the PmrJsonScope in effect when they're created (see
+    //!  GetJson()).  Strings are PmrJson::string_t, not std::string, so
+    //!  use get_ref<const PmrJson::string_t &>() (or compare with string
+    //!  literals) rather than get<std::string>().
+    //------------------------------------------------------------------------
+    using PmrJson =
+      nlohmann::basic_json<std::map, std::vector,
+                           std::basic_string<char, std::char_traits<char>,
+                                             PmrJsonAllocator<char>>,
+                           bool, std::int64_t, std::uint64_t, double,
+                           PmrJsonAllocator>;
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSPMR_HH_
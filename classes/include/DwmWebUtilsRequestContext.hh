@@ -0,0 +1,207 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsRequestContext.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::RequestContext class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSREQUESTCONTEXT_HH_
+#define _DWMWEBUTILSREQUESTCONTEXT_HH_
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "DwmWebUtilsConnection.hh"
+#include "DwmWebUtilsContentDecoder.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Reusable state for GET requests: the request and response
+    //!  messages, the read buffer, the body string, a content decoder
+    //!  and a memory arena for header fields and asynchronous operation
+    //!  state.  Everything is kept between requests, so once a context
+    //!  has been used for a few requests of similar size, further
+    //!  requests on an open connection make no heap allocations.  This
+    //!  is meant for polling the same URLs over and over; see
+    //!  Connection::Get(const Url &, RequestContext &, ...) and
+    //!  ConnectionPool::Get(const Url &, RequestContext &, ...).
+    //!
+    //!  A context may be used by only one thread at a time, and for only
+    //!  one request at a time.
+    //------------------------------------------------------------------------
+    class RequestContext
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Free lists of blocks of 2^n bytes, from which header fields and
+      //!  asynchronous operation state are allocated.  Blocks are only
+      //!  returned to the heap when the arena is destroyed.
+      //----------------------------------------------------------------------
+      class Arena
+      {
+      public:
+        Arena();
+        Arena(const Arena &) = delete;
+        Arena & operator = (const Arena &) = delete;
+        ~Arena();
+        
+        void *Allocate(size_t size);
+        void Deallocate(void *p, size_t size) noexcept;
+
+        //--------------------------------------------------------------------
+        //!  Returns the number of bytes held, in use or free.
+        //--------------------------------------------------------------------
+        size_t Size() const
+        { return _size; }
+        
+      private:
+        static constexpr size_t  k_minBlockShift = 4;
+        static constexpr size_t  k_numBlockSizes = 13;
+        
+        struct FreeBlock
+        {
+          FreeBlock  *next;
+        };
+
+        FreeBlock  *_free[k_numBlockSizes];
+        size_t      _size;
+
+        static size_t Index(size_t size);
+      };
+
+      //----------------------------------------------------------------------
+      //!  Allocates from (and returns memory to) an Arena.
+      //----------------------------------------------------------------------
+      template <typename T>
+      class Allocator
+      {
+      public:
+        using value_type = T;
+
+        explicit Allocator(Arena *arena) noexcept
+            : _arena(arena)
+        {}
+        
+        template <typename U>
+        Allocator(const Allocator<U> & a) noexcept
+            : _arena(a._arena)
+        {}
+
+        T *allocate(size_t n)
+        { return static_cast<T *>(_arena->Allocate(n * sizeof(T))); }
+
+        void deallocate(T *p, size_t n) noexcept
+        { _arena->Deallocate(p, n * sizeof(T)); }
+
+        template <typename U>
+        bool operator == (const Allocator<U> & a) const noexcept
+        { return (_arena == a._arena); }
+
+        template <typename U>
+        bool operator != (const Allocator<U> & a) const noexcept
+        { return (_arena != a._arena); }
+
+      private:
+        template <typename U> friend class Allocator;
+        
+        Arena  *_arena;
+      };
+
+      using Fields = http::basic_fields<Allocator<char>>;
+      using ResponseMessage = http::response<http::string_body,Fields>;
+      
+      //----------------------------------------------------------------------
+      //!  Constructor
+      //----------------------------------------------------------------------
+      RequestContext();
+
+      RequestContext(const RequestContext &) = delete;
+      RequestContext & operator = (const RequestContext &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Destructor
+      //----------------------------------------------------------------------
+      ~RequestContext();
+
+      //----------------------------------------------------------------------
+      //!  Returns the response to the last successful request.  Its body
+      //!  has been decoded if it had a Content-Encoding we support.
+      //----------------------------------------------------------------------
+      const ResponseMessage & Response() const
+      { return _response; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of bytes held in the arena, in use or free.
+      //----------------------------------------------------------------------
+      size_t ArenaSize() const
+      { return _arena.Size(); }
+      
+    private:
+      friend class Connection;
+      friend class ConnectionPool;
+
+      //  Destroyed last, after everything that holds its memory.
+      Arena                     _arena;
+      ConnectionKey             _key;
+      std::string               _target;
+      http::request<http::empty_body,Fields>  _request;
+      boost::beast::flat_buffer               _buffer;
+      ResponseMessage                         _response;
+      std::optional<http::response_parser<http::string_body,
+                                          Allocator<char>>>  _parser;
+      std::string               _decoded;
+      ContentDecoder            _decoder;
+
+      Allocator<char> GetAllocator()
+      { return Allocator<char>(&_arena); }
+      const ConnectionKey & Key(const Url & url, bool verifyCertificate);
+      void Prepare(const Url & url, bool keepAlive, bool compression);
+      void StartResponse();
+      void FinishResponse();
+      bool DecodeBody();
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSREQUESTCONTEXT_HH_
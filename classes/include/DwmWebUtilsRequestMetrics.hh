@@ -0,0 +1,267 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsRequestMetrics.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::RequestMetrics class definition
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSREQUESTMETRICS_HH_
+#define _DWMWEBUTILSREQUESTMETRICS_HH_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <boost/asio/ip/tcp.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Where the time went in a single request, and what it was able to
+    //!  reuse.  Filled in when a RequestOptions with Metrics() set is
+    //!  used for GetResponse(), GetStatus(), GetJson() or the Connection
+    //!  and ConnectionPool requests behind them.
+    //!
+    //!  Each phase of the request is marked with the time it finished.
+    //!  Phases that didn't happen (no DNS lookup or TCP connect on a
+    //!  reused connection, no TLS handshake for http, no JSON parse for
+    //!  GetResponse()) are left unmarked, and the durations that depend
+    //!  on them are zero.
+    //------------------------------------------------------------------------
+    class RequestMetrics
+    {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      //----------------------------------------------------------------------
+      //!  The phases of a request, in the order they happen.
+      //----------------------------------------------------------------------
+      typedef enum {
+        e_start,          //!< request started
+        e_dnsDone,        //!< host name resolved
+        e_connectDone,    //!< TCP connection established
+        e_tlsDone,        //!< TLS handshake finished (https only)
+        e_requestSent,    //!< request written
+        e_firstByte,      //!< first part of the response read
+        e_bodyDone,       //!< last of the response read
+        e_parseDone,      //!< JSON parsed (GetJson() only)
+        e_numPhases
+      } PhaseEnum;
+
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      RequestMetrics() = default;
+
+      //----------------------------------------------------------------------
+      //!  Resets to the default-constructed state.  Done at the start of
+      //!  each request, so the same RequestMetrics may be used for
+      //!  consecutive requests.
+      //----------------------------------------------------------------------
+      void Clear()
+      { *this = RequestMetrics(); }
+
+      //----------------------------------------------------------------------
+      //!  Marks the end of @c phase at time @c when and returns @c when.
+      //----------------------------------------------------------------------
+      Clock::time_point Mark(PhaseEnum phase,
+                             Clock::time_point when = Clock::now())
+      { return _marks[phase] = when; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time at which @c phase finished, or a
+      //!  default-constructed time point if it wasn't reached.
+      //----------------------------------------------------------------------
+      Clock::time_point When(PhaseEnum phase) const
+      { return _marks[phase]; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if @c phase was reached.
+      //----------------------------------------------------------------------
+      bool Reached(PhaseEnum phase) const
+      { return (_marks[phase] != Clock::time_point()); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time from the end of phase @c from to the end of
+      //!  phase @c to, or zero if either wasn't reached.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds Between(PhaseEnum from, PhaseEnum to) const
+      {
+        using std::chrono::duration_cast, std::chrono::microseconds;
+        return ((Reached(from) && Reached(to))
+                ? duration_cast<microseconds>(_marks[to] - _marks[from])
+                : microseconds(0));
+      }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time spent resolving the host name.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds DnsTime() const
+      { return Between(e_start, e_dnsDone); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time spent establishing the TCP connection.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds ConnectTime() const
+      { return Between(e_dnsDone, e_connectDone); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time spent in the TLS handshake.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds TlsTime() const
+      { return Between(e_connectDone, e_tlsDone); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time from writing the request to reading the first
+      //!  part of the response.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds TimeToFirstByte() const
+      { return Between(e_requestSent, e_firstByte); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time from reading the first part of the response to
+      //!  reading the last of it.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds TransferTime() const
+      { return Between(e_firstByte, e_bodyDone); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time from reading the last of the response to
+      //!  having the parsed JSON.  When the JSON is parsed as the body
+      //!  arrives, most of the parsing is in TransferTime() and this is
+      //!  only what was left at the end.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds ParseTime() const
+      { return Between(e_bodyDone, e_parseDone); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time from the start of the request to the end of
+      //!  the last phase reached.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds Elapsed() const
+      {
+        for (int phase = e_numPhases - 1; phase > e_start; --phase) {
+          if (Reached((PhaseEnum)phase)) {
+            return Between(e_start, (PhaseEnum)phase);
+          }
+        }
+        return std::chrono::microseconds(0);
+      }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the number of response bytes read (header and body, as
+      //!  sent by the server, i.e. before any content decoding).
+      //----------------------------------------------------------------------
+      uint64_t BytesRead() const
+      { return _bytesRead; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the number of response bytes read.
+      //----------------------------------------------------------------------
+      uint64_t BytesRead(uint64_t bytesRead)
+      { return _bytesRead = bytesRead; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the request was sent on a connection that was
+      //!  already open (e.g. from a ConnectionPool).
+      //----------------------------------------------------------------------
+      bool ConnectionReused() const
+      { return _connectionReused; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns whether the connection was already open.
+      //----------------------------------------------------------------------
+      bool ConnectionReused(bool connectionReused)
+      { return _connectionReused = connectionReused; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the TLS handshake for the request resumed a
+      //!  session from the TLSSessionCache.  False if there was no
+      //!  handshake.
+      //----------------------------------------------------------------------
+      bool TlsSessionReused() const
+      { return _tlsSessionReused; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns whether the TLS session was resumed.
+      //----------------------------------------------------------------------
+      bool TlsSessionReused(bool tlsSessionReused)
+      { return _tlsSessionReused = tlsSessionReused; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the host name came from the ResolverCache.
+      //!  False if there was no lookup.
+      //----------------------------------------------------------------------
+      bool DnsCached() const
+      { return _dnsCached; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns whether the host name came from the
+      //!  ResolverCache.
+      //----------------------------------------------------------------------
+      bool DnsCached(bool dnsCached)
+      { return _dnsCached = dnsCached; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the address and port of the server the request was sent
+      //!  to.  Default-constructed if we never connected.
+      //----------------------------------------------------------------------
+      const boost::asio::ip::tcp::endpoint & RemoteEndpoint() const
+      { return _remoteEndpoint; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the address and port of the server.
+      //----------------------------------------------------------------------
+      const boost::asio::ip::tcp::endpoint &
+      RemoteEndpoint(const boost::asio::ip::tcp::endpoint & remoteEndpoint)
+      { return _remoteEndpoint = remoteEndpoint; }
+      
+    private:
+      std::array<Clock::time_point,e_numPhases>  _marks{};
+      uint64_t                                   _bytesRead = 0;
+      bool                                       _connectionReused = false;
+      bool                                       _tlsSessionReused = false;
+      bool                                       _dnsCached = false;
+      boost::asio::ip::tcp::endpoint             _remoteEndpoint;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSREQUESTMETRICS_HH_
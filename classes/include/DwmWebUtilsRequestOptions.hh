@@ -0,0 +1,233 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsRequestOptions.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::RequestOptions class definition
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSREQUESTOPTIONS_HH_
+#define _DWMWEBUTILSREQUESTOPTIONS_HH_
+
+#include <chrono>
+#include <memory>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    class RequestMetrics;
+    class ResponseCache;
+    
+    //------------------------------------------------------------------------
+    //!  Per-request options: timeouts, connection attempt pacing,
+    //!  compression, HTTP/2, an optional response cache and optional
+    //!  metrics.  A timeout of
+    //!  zero means no limit.  A request that fails because a timeout
+    //!  expired fails with @c GetFailure::k_failNumTimeout.
+    //------------------------------------------------------------------------
+    class RequestOptions
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Default constructor: 10 second connect timeout, 250 millisecond
+      //!  connection attempt delay, 10 second TLS handshake timeout, 30
+      //!  second idle read timeout, no total timeout, compression, no
+      //!  HTTP/2, no cache and no metrics.
+      //----------------------------------------------------------------------
+      RequestOptions() = default;
+
+      //----------------------------------------------------------------------
+      //!  Returns the connect timeout.  This covers resolving the host
+      //!  name and establishing the TCP connection.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds ConnectTimeout() const
+      { return _connectTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the connect timeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds
+      ConnectTimeout(std::chrono::milliseconds connectTimeout)
+      { return _connectTimeout = connectTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the connection attempt delay.  When a host name resolves
+      //!  to more than one address, we start a connection attempt to the
+      //!  next address (alternating between IPv6 and IPv4) each time this
+      //!  delay passes without a connection being established, or as soon
+      //!  as an attempt fails, and use whichever connects first (RFC 8305
+      //!  "Happy Eyeballs").  Zero means one attempt at a time, each
+      //!  starting only when the previous one fails.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds ConnectAttemptDelay() const
+      { return _connectAttemptDelay; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the connection attempt delay.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds
+      ConnectAttemptDelay(std::chrono::milliseconds connectAttemptDelay)
+      { return _connectAttemptDelay = connectAttemptDelay; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the TLS handshake timeout (https only).  This also
+      //!  bounds the TLS shutdown when a connection is closed.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds HandshakeTimeout() const
+      { return _handshakeTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the TLS handshake timeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds
+      HandshakeTimeout(std::chrono::milliseconds handshakeTimeout)
+      { return _handshakeTimeout = handshakeTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the idle read timeout: the longest we'll wait for the
+      //!  server to send anything while reading the response (or to
+      //!  accept anything while sending the request).  A server that
+      //!  trickles a large response keeps resetting this timer; use
+      //!  TotalTimeout() to bound the whole request.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds IdleReadTimeout() const
+      { return _idleReadTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the idle read timeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds
+      IdleReadTimeout(std::chrono::milliseconds idleReadTimeout)
+      { return _idleReadTimeout = idleReadTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the total timeout: a deadline for the whole request,
+      //!  including connecting (when needed) and reading the response.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds TotalTimeout() const
+      { return _totalTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the total timeout.
+      //----------------------------------------------------------------------
+      std::chrono::milliseconds
+      TotalTimeout(std::chrono::milliseconds totalTimeout)
+      { return _totalTimeout = totalTimeout; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if requests ask for compressed responses (with an
+      //!  Accept-Encoding header).  Responses we can decode are decoded
+      //!  as they're read either way.  Defaults to true.
+      //----------------------------------------------------------------------
+      bool Compression() const
+      { return _compression; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns whether requests ask for compressed responses.
+      //----------------------------------------------------------------------
+      bool Compression(bool compression)
+      { return _compression = compression; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns true if https requests made through a ConnectionPool
+      //!  should use HTTP/2 when the server supports it (negotiated with
+      //!  ALPN).  Concurrent requests to the same host are then sent as
+      //!  streams on one shared connection (see Http2Session).  Has no
+      //!  effect if the library was built without nghttp2.  Defaults to
+      //!  false.
+      //----------------------------------------------------------------------
+      bool Http2() const
+      { return _http2; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns whether pooled https requests use HTTP/2.
+      //----------------------------------------------------------------------
+      bool Http2(bool http2)
+      { return _http2 = http2; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the response cache, if any.  By default there is none.
+      //----------------------------------------------------------------------
+      const std::shared_ptr<ResponseCache> & Cache() const
+      { return _cache; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the response cache.  The same cache may be
+      //!  shared by any number of requests and threads.
+      //----------------------------------------------------------------------
+      const std::shared_ptr<ResponseCache> &
+      Cache(const std::shared_ptr<ResponseCache> & cache)
+      { return _cache = cache; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the RequestMetrics to fill in, if any.  By default there
+      //!  are none.
+      //----------------------------------------------------------------------
+      RequestMetrics *Metrics() const
+      { return _metrics; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the RequestMetrics to fill in.  They're
+      //!  cleared at the start of each request, and must outlive it.
+      //!  Don't share them between concurrent requests.  Requests sent
+      //!  on an HTTP/2 session (see Http2()) don't fill them in.
+      //----------------------------------------------------------------------
+      RequestMetrics *Metrics(RequestMetrics *metrics)
+      { return _metrics = metrics; }
+      
+    private:
+      std::chrono::milliseconds  _connectTimeout =
+        std::chrono::milliseconds(10000);
+      std::chrono::milliseconds  _connectAttemptDelay =
+        std::chrono::milliseconds(250);
+      std::chrono::milliseconds  _handshakeTimeout =
+        std::chrono::milliseconds(10000);
+      std::chrono::milliseconds  _idleReadTimeout =
+        std::chrono::milliseconds(30000);
+      std::chrono::milliseconds  _totalTimeout =
+        std::chrono::milliseconds(0);
+      bool                       _compression = true;
+      bool                       _http2 = false;
+      std::shared_ptr<ResponseCache>  _cache;
+      RequestMetrics                 *_metrics = nullptr;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSREQUESTOPTIONS_HH_
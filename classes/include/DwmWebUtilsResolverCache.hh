@@ -0,0 +1,235 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsResolverCache.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ResolverCache class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSRESOLVERCACHE_HH_
+#define _DWMWEBUTILSRESOLVERCACHE_HH_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <boost/asio.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Process-wide cache of host name resolutions, keyed by host and
+    //!  service (port).  Successful resolutions are cached for
+    //!  PositiveTTL(), and resolutions that failed because the name (or
+    //!  service) does not exist are cached for NegativeTTL().  Transient
+    //!  failures, timeouts and cancellations are not cached.
+    //!
+    //!  When a positive entry is looked up within RefreshAhead() of its
+    //!  expiry, it is re-resolved on a background thread while the cached
+    //!  results continue to be used, so busy hosts don't see a resolution
+    //!  stall when their entry expires.
+    //!
+    //!  getaddrinfo() doesn't give us the DNS TTL, so the TTLs here are
+    //!  our own.  All members are thread safe.
+    //------------------------------------------------------------------------
+    class ResolverCache
+    {
+    public:
+      using Clock = std::chrono::steady_clock;
+      using Results = boost::asio::ip::tcp::resolver::results_type;
+      
+      //----------------------------------------------------------------------
+      //!  If we have an unexpired entry for @c host and @c service, sets
+      //!  @c results and @c ec from it and returns true.  @c ec will be
+      //!  set (and @c results empty) for a negative entry.  Returns false
+      //!  if we have no unexpired entry.
+      //----------------------------------------------------------------------
+      static bool Lookup(const std::string & host,
+                         const std::string & service, Results & results,
+                         boost::system::error_code & ec);
+
+      //----------------------------------------------------------------------
+      //!  Stores the outcome of resolving @c host and @c service.  If
+      //!  @c ec is not set, @c results are cached for PositiveTTL().  If
+      //!  @c ec indicates the name or service does not exist, the failure
+      //!  is cached for NegativeTTL().  Other failures are ignored.
+      //----------------------------------------------------------------------
+      static void Insert(const std::string & host,
+                         const std::string & service, const Results & results,
+                         const boost::system::error_code & ec);
+
+      //----------------------------------------------------------------------
+      //!  Returns the time for which successful resolutions are cached.
+      //!  Default is 60 seconds.
+      //----------------------------------------------------------------------
+      static std::chrono::milliseconds PositiveTTL()
+      { return _positiveTTL.load(); }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the time for which successful resolutions are
+      //!  cached.  Zero disables caching of successful resolutions.
+      //----------------------------------------------------------------------
+      static std::chrono::milliseconds
+      PositiveTTL(std::chrono::milliseconds ttl)
+      { _positiveTTL = ttl; return ttl; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the time for which failed resolutions are cached.
+      //!  Default is 5 seconds.
+      //----------------------------------------------------------------------
+      static std::chrono::milliseconds NegativeTTL()
+      { return _negativeTTL.load(); }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the time for which failed resolutions are
+      //!  cached.  Zero disables caching of failed resolutions.
+      //----------------------------------------------------------------------
+      static std::chrono::milliseconds
+      NegativeTTL(std::chrono::milliseconds ttl)
+      { _negativeTTL = ttl; return ttl; }
+
+      //----------------------------------------------------------------------
+      //!  Returns how long before expiry a positive entry is refreshed in
+      //!  the background when it's used.  Default is 10 seconds.
+      //----------------------------------------------------------------------
+      static std::chrono::milliseconds RefreshAhead()
+      { return _refreshAhead.load(); }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns how long before expiry a positive entry is
+      //!  refreshed in the background when it's used.  Zero disables
+      //!  refresh-ahead.
+      //----------------------------------------------------------------------
+      static std::chrono::milliseconds
+      RefreshAhead(std::chrono::milliseconds refreshAhead)
+      { _refreshAhead = refreshAhead; return refreshAhead; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the maximum number of entries.  Default is 4096.
+      //----------------------------------------------------------------------
+      static size_t MaxEntries()
+      { return _maxEntries.load(); }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the maximum number of entries.  When the cache
+      //!  is full, expired entries are dropped to make room, and if there
+      //!  are none, the entry closest to expiry is dropped.
+      //----------------------------------------------------------------------
+      static size_t MaxEntries(size_t maxEntries)
+      { _maxEntries = maxEntries; return maxEntries; }
+      
+      //----------------------------------------------------------------------
+      //!  Discards all entries.  Does not reset the counters.
+      //----------------------------------------------------------------------
+      static void Clear();
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of entries (including expired entries that
+      //!  have not yet been dropped).
+      //----------------------------------------------------------------------
+      static size_t Size();
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of lookups satisfied by a positive entry.
+      //----------------------------------------------------------------------
+      static uint64_t Hits()
+      { return _hits; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of lookups satisfied by a negative entry.
+      //----------------------------------------------------------------------
+      static uint64_t NegativeHits()
+      { return _negativeHits; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of lookups that found no unexpired entry.
+      //----------------------------------------------------------------------
+      static uint64_t Misses()
+      { return _misses; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of background refreshes started.
+      //----------------------------------------------------------------------
+      static uint64_t Refreshes()
+      { return _refreshes; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of background refreshes that failed (the
+      //!  existing entry is kept until it expires).
+      //----------------------------------------------------------------------
+      static uint64_t RefreshFailures()
+      { return _refreshFailures; }
+      
+    private:
+      using Key = std::pair<std::string,std::string>;
+
+      struct Entry
+      {
+        Results                    results;
+        boost::system::error_code  ec;
+        Clock::time_point          expires;
+        bool                       refreshing = false;
+      };
+      
+      static std::mutex                                 _mtx;
+      static std::map<Key,Entry>                        _entries;
+      static std::atomic<std::chrono::milliseconds>     _positiveTTL;
+      static std::atomic<std::chrono::milliseconds>     _negativeTTL;
+      static std::atomic<std::chrono::milliseconds>     _refreshAhead;
+      static std::atomic<size_t>                        _maxEntries;
+      static std::atomic<uint64_t>                      _hits;
+      static std::atomic<uint64_t>                      _negativeHits;
+      static std::atomic<uint64_t>                      _misses;
+      static std::atomic<uint64_t>                      _refreshes;
+      static std::atomic<uint64_t>                      _refreshFailures;
+      static std::unique_ptr<boost::asio::thread_pool>  _refresher;
+
+      static bool IsNegative(const boost::system::error_code & ec);
+      static void MakeRoom(Clock::time_point now);
+      static void Refresh(const Key & key);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSRESOLVERCACHE_HH_
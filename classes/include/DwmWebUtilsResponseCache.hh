@@ -0,0 +1,220 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsResponseCache.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ResponseCache class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSRESPONSECACHE_HH_
+#define _DWMWEBUTILSRESPONSECACHE_HH_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <boost/version.hpp>
+#if (BOOST_VERSION < 108000)
+  #define BOOST_BEAST_USE_STD_STRING_VIEW // deprecated with newer boost
+#endif
+#include <boost/beast.hpp>
+#include <nlohmann/json.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace http = boost::beast::http;
+    
+    //------------------------------------------------------------------------
+    //!  An HTTP response cache, for polling resources that rarely change.
+    //!  A cache is used by setting it in RequestOptions::Cache().
+    //!
+    //!  Only 200 responses to GET requests are stored, and only if they
+    //!  don't say Cache-Control: no-store and have a max-age, an ETag or
+    //!  a Last-Modified header.  Until an entry's max-age (less any Age)
+    //!  passes, requests for its URL are answered from the cache without
+    //!  touching the network.  After that, requests carry If-None-Match
+    //!  and If-Modified-Since, and a 304 reply is answered with the cached
+    //!  response (and its lifetime renewed).  Any other reply replaces or
+    //!  removes the entry.  GetJson() also keeps the parsed JSON with the
+    //!  entry, so a cached or revalidated response isn't parsed again.
+    //!
+    //!  If constructed with a directory, entries are also written there
+    //!  and read back by later instances (e.g. after a restart).
+    //!
+    //!  Vary is not supported; we always send the same request headers.
+    //------------------------------------------------------------------------
+    class ResponseCache
+    {
+    public:
+      using Clock = std::chrono::system_clock;
+      
+      //----------------------------------------------------------------------
+      //!  A cached response.
+      //----------------------------------------------------------------------
+      struct Entry
+      {
+        http::response<http::string_body>       response;
+        std::string                             etag;
+        std::string                             lastModified;
+        Clock::time_point                       expires;
+        std::shared_ptr<const nlohmann::json>   json;
+
+        //--------------------------------------------------------------------
+        //!  Returns true if the entry may be used without revalidation.
+        //--------------------------------------------------------------------
+        bool Fresh() const
+        { return (Clock::now() < expires); }
+      };
+
+      //----------------------------------------------------------------------
+      //!  Constructs an in-memory cache.  If @c directory is not empty,
+      //!  entries are also stored in (and loaded from) files in
+      //!  @c directory, which must exist.
+      //----------------------------------------------------------------------
+      ResponseCache(const std::string & directory = std::string());
+
+      ResponseCache(const ResponseCache &) = delete;
+      ResponseCache & operator = (const ResponseCache &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Returns the cache key for @c url.
+      //----------------------------------------------------------------------
+      static std::string Key(const std::string & url)
+      { return url; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the entry for @c key, or nullptr if there is none.
+      //----------------------------------------------------------------------
+      std::shared_ptr<const Entry> Find(const std::string & key);
+
+      //----------------------------------------------------------------------
+      //!  Updates the cache with @c response, just received for @c key.
+      //!  A cacheable 200 response replaces the entry; a 304 response
+      //!  renews it; anything else removes it.  Returns the entry for
+      //!  @c key afterward, or nullptr if there is none.
+      //----------------------------------------------------------------------
+      std::shared_ptr<const Entry>
+      Update(const std::string & key,
+             const http::response<http::string_body> & response);
+
+      //----------------------------------------------------------------------
+      //!  If the entry for @c key has parsed JSON, copies it to @c json and
+      //!  returns true.  Else returns false.
+      //----------------------------------------------------------------------
+      bool FindJson(const std::string & key, nlohmann::json & json);
+
+      //----------------------------------------------------------------------
+      //!  Keeps @c json (parsed from the entry's body) with the entry for
+      //!  @c key, if there is one.
+      //----------------------------------------------------------------------
+      void StoreJson(const std::string & key, const nlohmann::json & json);
+      
+      //----------------------------------------------------------------------
+      //!  Returns the maximum number of entries kept in memory.
+      //----------------------------------------------------------------------
+      size_t MaxEntries() const;
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the maximum number of entries kept in memory.
+      //!  When the cache is full, the entry closest to expiring is
+      //!  evicted.
+      //----------------------------------------------------------------------
+      size_t MaxEntries(size_t maxEntries);
+      
+      //----------------------------------------------------------------------
+      //!  Removes all entries (including any on disk).
+      //----------------------------------------------------------------------
+      void Clear();
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of entries in memory.
+      //----------------------------------------------------------------------
+      size_t Size() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of requests answered without the network.
+      //----------------------------------------------------------------------
+      uint64_t Hits() const
+      { return _hits; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of 304 responses, i.e. requests answered from
+      //!  the cache after revalidation.
+      //----------------------------------------------------------------------
+      uint64_t Revalidations() const
+      { return _revalidations; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of responses stored.
+      //----------------------------------------------------------------------
+      uint64_t Stores() const
+      { return _stores; }
+
+      //----------------------------------------------------------------------
+      //!  Counts a request answered from a fresh entry.
+      //----------------------------------------------------------------------
+      void CountHit()
+      { ++_hits; }
+      
+    private:
+      using EntryMap = std::map<std::string,std::shared_ptr<const Entry>>;
+      
+      std::string            _directory;
+      mutable std::mutex     _mtx;
+      EntryMap               _entries;
+      size_t                 _maxEntries;
+      std::atomic<uint64_t>  _hits;
+      std::atomic<uint64_t>  _revalidations;
+      std::atomic<uint64_t>  _stores;
+
+      void Insert(const std::string & key, std::shared_ptr<const Entry> entry);
+      void Erase(const std::string & key);
+      std::string Path(const std::string & key) const;
+      std::shared_ptr<const Entry> Load(const std::string & key) const;
+      void Save(const std::string & key, const Entry & entry) const;
+      static Clock::time_point Expires(const http::fields & fields);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSRESPONSECACHE_HH_
@@ -0,0 +1,88 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsSSLContextCache.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::SSLContextCache class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSSSLCONTEXTCACHE_HH_
+#define _DWMWEBUTILSSSLCONTEXTCACHE_HH_
+
+#include <memory>
+#include <mutex>
+#include <boost/asio/ssl.hpp>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Process-wide cache of client SSL contexts: one that verifies the
+    //!  server's certificate and one that does not.  Building an SSL
+    //!  context loads the system trust store, which is expensive, so we
+    //!  only do it once per context (lazily) and share the result with
+    //!  every https connection.
+    //------------------------------------------------------------------------
+    class SSLContextCache
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Returns the shared client SSL context for the given value of
+      //!  @c verifyCertificate, creating it if necessary.  Thread safe.
+      //----------------------------------------------------------------------
+      static std::shared_ptr<boost::asio::ssl::context>
+      Get(bool verifyCertificate);
+
+      //----------------------------------------------------------------------
+      //!  Discards the cached contexts so the next call to Get() builds new
+      //!  ones, and clears the TLSSessionCache.  Call this when the system
+      //!  CA bundle has changed.  Connections using an old context keep
+      //!  using it until they're closed.
+      //----------------------------------------------------------------------
+      static void Reload();
+      
+    private:
+      static std::mutex                                  _mtx;
+      static std::shared_ptr<boost::asio::ssl::context>  _verifyContext;
+      static std::shared_ptr<boost::asio::ssl::context>  _noVerifyContext;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSSSLCONTEXTCACHE_HH_
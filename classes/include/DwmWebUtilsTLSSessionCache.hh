@@ -0,0 +1,126 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsTLSSessionCache.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::TLSSessionCache class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSTLSSESSIONCACHE_HH_
+#define _DWMWEBUTILSTLSSESSIONCACHE_HH_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <boost/asio/ssl.hpp>
+
+#include "DwmWebUtilsConnection.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Process-wide client-side cache of TLS sessions (TLS 1.2 sessions
+    //!  and TLS 1.3 session tickets), keyed by ConnectionKey.  When we
+    //!  connect to a host we've connected to before, the cached session
+    //!  is offered to the server so the handshake can be abbreviated
+    //!  (no certificate chain transfer and verification).
+    //------------------------------------------------------------------------
+    class TLSSessionCache
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Enables client session caching on @c ctx.  New sessions
+      //!  (including TLS 1.3 tickets that arrive after the handshake) for
+      //!  connections created from @c ctx will be stored in the cache.
+      //----------------------------------------------------------------------
+      static void Enable(boost::asio::ssl::context & ctx);
+
+      //----------------------------------------------------------------------
+      //!  Associates @c ssl with @c key and, if we have a cached session
+      //!  for @c key, sets it as the session to be resumed.  Must be called
+      //!  before the handshake.  @c key must remain valid for the lifetime
+      //!  of @c ssl.
+      //----------------------------------------------------------------------
+      static void Offer(SSL *ssl, const ConnectionKey & key);
+
+      //----------------------------------------------------------------------
+      //!  Records the outcome of a handshake on @c ssl: a hit if a session
+      //!  was resumed, else a miss.  If the handshake failed, any cached
+      //!  session for the key is discarded.
+      //----------------------------------------------------------------------
+      static void HandshakeDone(SSL *ssl, bool success);
+
+      //----------------------------------------------------------------------
+      //!  Discards all cached sessions.
+      //----------------------------------------------------------------------
+      static void Clear();
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of cached sessions.
+      //----------------------------------------------------------------------
+      static size_t Size();
+      
+      //----------------------------------------------------------------------
+      //!  Returns the number of handshakes that resumed a cached session.
+      //----------------------------------------------------------------------
+      static uint64_t Hits()
+      { return _hits; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the number of handshakes that did not resume a session.
+      //----------------------------------------------------------------------
+      static uint64_t Misses()
+      { return _misses; }
+      
+    private:
+      static std::mutex                          _mtx;
+      static std::map<ConnectionKey,SSL_SESSION *> _sessions;
+      static std::atomic<uint64_t>               _hits;
+      static std::atomic<uint64_t>               _misses;
+
+      static int KeyIndex();
+      static int NewSessionCallback(SSL *ssl, SSL_SESSION *session);
+      static void Forget(const ConnectionKey & key);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSTLSSESSIONCACHE_HH_
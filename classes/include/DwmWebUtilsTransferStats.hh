@@ -0,0 +1,122 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsTransferStats.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::TransferStats class definition
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSTRANSFERSTATS_HH_
+#define _DWMWEBUTILSTRANSFERSTATS_HH_
+
+#include <chrono>
+#include <cstdint>
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Statistics for a single download (see GetToFile()).
+    //------------------------------------------------------------------------
+    class TransferStats
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      TransferStats() = default;
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of body bytes received.  For a resumed
+      //!  download this does not include the bytes we already had.
+      //----------------------------------------------------------------------
+      uint64_t Bytes() const
+      { return _bytes; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the number of body bytes received.
+      //----------------------------------------------------------------------
+      uint64_t Bytes(uint64_t bytes)
+      { return _bytes = bytes; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the offset at which a resumed download started, or 0 if
+      //!  the download was not resumed.
+      //----------------------------------------------------------------------
+      uint64_t ResumedAt() const
+      { return _resumedAt; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the offset at which a resumed download started.
+      //----------------------------------------------------------------------
+      uint64_t ResumedAt(uint64_t resumedAt)
+      { return _resumedAt = resumedAt; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the time from sending the request to receiving the end
+      //!  of the response.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds Elapsed() const
+      { return _elapsed; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the time from sending the request to receiving
+      //!  the end of the response.
+      //----------------------------------------------------------------------
+      std::chrono::microseconds Elapsed(std::chrono::microseconds elapsed)
+      { return _elapsed = elapsed; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the transfer rate in bytes per second.
+      //----------------------------------------------------------------------
+      double BytesPerSecond() const
+      {
+        return ((_elapsed.count() > 0)
+                ? ((_bytes * 1000000.0) / _elapsed.count()) : 0.0);
+      }
+      
+    private:
+      uint64_t                   _bytes = 0;
+      uint64_t                   _resumedAt = 0;
+      std::chrono::microseconds  _elapsed = std::chrono::microseconds(0);
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSTRANSFERSTATS_HH_
@@ -1,7 +1,7 @@
 //===========================================================================
 // @(#) $DwmPath$
 //===========================================================================
-//  Copyright (c) Daniel W. McRobb 2022, 2024
+//  Copyright (c) Daniel W. McRobb 2022, 2024, 2026
 //  All rights reserved.
 //
 //  Redistribution and use in source and binary forms, with or without
@@ -42,13 +42,18 @@
 #ifndef _DWMWEBUTILSURL_HH_
 #define _DWMWEBUTILSURL_HH_
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <boost/asio.hpp>
 
 namespace Dwm {
 
   namespace WebUtils {
 
+    class UrlView;
+    
     //------------------------------------------------------------------------
     //!  A simple encapsulation of a URL.
     //------------------------------------------------------------------------
@@ -66,11 +71,25 @@ namespace Dwm {
       //----------------------------------------------------------------------
       Url(const std::string & url);
 
+      //----------------------------------------------------------------------
+      //!  Construct from a UrlView, copying its components.  No parsing
+      //!  is done.
+      //----------------------------------------------------------------------
+      explicit Url(const UrlView & urlView);
+
+      //----------------------------------------------------------------------
+      //!  Copies the components of @c urlView into @c this, reusing our
+      //!  strings' storage.
+      //----------------------------------------------------------------------
+      Url & operator = (const UrlView & urlView);
+
       //----------------------------------------------------------------------
       //!  Parses @c url and stores the parsed components in @c this.
-      //!  Returns true on success, false on failure.
+      //!  Returns true on success, false on failure.  Makes no heap
+      //!  allocations once our strings are big enough for the components
+      //!  of @c url, so reusing a Url to parse many URLs is cheap.
       //----------------------------------------------------------------------
-      bool Parse(const std::string & url);
+      bool Parse(std::string_view url);
 
       //----------------------------------------------------------------------
       //!  Clears the Url (sets the contents the same as the default
@@ -169,10 +188,30 @@ namespace Dwm {
       std::string AfterAuthority() const;
 
       //----------------------------------------------------------------------
-      //!  Returns the Url as a string.
+      //!  Returns the Url as a string.  The port is always included
+      //!  unless @c elideDefaultPort is true and the port is the default
+      //!  for the scheme.
       //----------------------------------------------------------------------
-      std::string to_string() const;
+      std::string to_string(bool elideDefaultPort = false) const;
 
+      //----------------------------------------------------------------------
+      //!  Normalizes the Url as described in RFC 3986 section 6.2.2: the
+      //!  scheme and host are lowercased, percent-encoded octets have
+      //!  uppercase hex digits and unreserved characters are decoded, and
+      //!  "." and ".." segments are removed from the path.  Two URLs
+      //!  that differ only in those ways compare equal after both are
+      //!  normalized.  The port is already the scheme's default when the
+      //!  URL didn't have one, so "http://a.com" and "http://a.com:80"
+      //!  are equal without normalization.
+      //----------------------------------------------------------------------
+      void Normalize();
+      
+      //----------------------------------------------------------------------
+      //!  Returns a hash of the Url, the same as std::hash<Url>.  Equal to
+      //!  the hash of a UrlView with the same components.
+      //----------------------------------------------------------------------
+      size_t Hash() const;
+      
       //----------------------------------------------------------------------
       //!  Equality comparison operator
       //----------------------------------------------------------------------
@@ -186,17 +225,20 @@ namespace Dwm {
       std::string   _path;
       std::string   _query;
       std::string   _fragment;
-
-      static bool HasIllegalHyphens(const std::string & host);
-      static bool HasAlpha(const std::string & host);
-      static bool IsAddress(const std::string & host);
-      static bool IsZeroAddress(const std::string & host);
-      static bool IsMulticast(const std::string & host);
-      static uint16_t PortFromScheme(const std::string & scheme);
     };
 
   }  // namespace WebUtils
   
 }  // namespace Dwm
 
+//----------------------------------------------------------------------------
+//!  So Urls can be used as keys in unordered containers.
+//----------------------------------------------------------------------------
+template <>
+struct std::hash<Dwm::WebUtils::Url>
+{
+  size_t operator () (const Dwm::WebUtils::Url & url) const noexcept
+  { return url.Hash(); }
+};
+
 #endif  // _DWMWEBUTILSURL_HH_
@@ -0,0 +1,242 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrlBatch.hh
+//!  \author Daniel W. McRobb
+//!  \brief Bulk URL validation declarations
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSURLBATCH_HH_
+#define _DWMWEBUTILSURLBATCH_HH_
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "DwmWebUtilsUrlView.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  The result of validating one URL with ParseUrls() or
+    //!  ParseUrlLines(): whether it's valid, and where its components are.
+    //!  Component offsets are relative to the start of the URL (Start()),
+    //!  so a list of these is compact and doesn't hold pointers into the
+    //!  input.  The components are only meaningful if Valid() is true.
+    //------------------------------------------------------------------------
+    class UrlOffsets
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Offset (from Start()) and length of a component.
+      //----------------------------------------------------------------------
+      using Range = std::pair<uint32_t,uint32_t>;
+      
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      UrlOffsets() = default;
+
+      //----------------------------------------------------------------------
+      //!  Returns the offset of the URL in the input.  For ParseUrls()
+      //!  this is always 0.
+      //----------------------------------------------------------------------
+      size_t Start() const
+      { return _start; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the length of the URL.
+      //----------------------------------------------------------------------
+      uint32_t Length() const
+      { return _length; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the URL is valid (would be accepted by
+      //!  Url::Parse()).
+      //----------------------------------------------------------------------
+      bool Valid() const
+      { return _valid; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the port, which is the default for the scheme if the
+      //!  URL didn't have one.
+      //----------------------------------------------------------------------
+      uint16_t Port() const
+      { return _port; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the location of the scheme.
+      //----------------------------------------------------------------------
+      const Range & Scheme() const
+      { return _scheme; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the location of the user info.
+      //----------------------------------------------------------------------
+      const Range & UserInfo() const
+      { return _userinfo; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the location of the host (without brackets for an IPv6
+      //!  address).
+      //----------------------------------------------------------------------
+      const Range & Host() const
+      { return _host; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the location of the path.  If the URL had no path, the
+      //!  length is 0 (and View() will return a path of "/").
+      //----------------------------------------------------------------------
+      const Range & Path() const
+      { return _path; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the location of the query.
+      //----------------------------------------------------------------------
+      const Range & Query() const
+      { return _query; }
+      
+      //----------------------------------------------------------------------
+      //!  Returns the location of the fragment.
+      //----------------------------------------------------------------------
+      const Range & Fragment() const
+      { return _fragment; }
+
+      //----------------------------------------------------------------------
+      //!  Returns a UrlView of the URL in @c input, which must be what was
+      //!  passed to ParseUrlLines(), or the URL itself for ParseUrls().
+      //----------------------------------------------------------------------
+      UrlView View(std::string_view input) const;
+
+      //----------------------------------------------------------------------
+      //!  Sets @c this from @c urlView, which was parsed from @c url.
+      //!  @c url starts at offset @c start in the input.
+      //----------------------------------------------------------------------
+      void Set(size_t start, std::string_view url, const UrlView & urlView,
+               bool valid);
+      
+    private:
+      size_t    _start = 0;
+      uint32_t  _length = 0;
+      uint16_t  _port = 0;
+      bool      _valid = false;
+      Range     _scheme;
+      Range     _userinfo;
+      Range     _host;
+      Range     _path;
+      Range     _query;
+      Range     _fragment;
+    };
+
+    //------------------------------------------------------------------------
+    //!  Validates each URL in @c urls and stores the results in
+    //!  @c results (one per URL, in the same order).  Large inputs are
+    //!  split across up to @c maxThreads threads; 0 means one per core.
+    //!  Returns the number of valid URLs.
+    //------------------------------------------------------------------------
+    size_t ParseUrls(std::span<const std::string_view> urls,
+                     std::vector<UrlOffsets> & results,
+                     unsigned int maxThreads = 0);
+
+    //------------------------------------------------------------------------
+    //!  Just like ParseUrls() above, for an array of strings.
+    //------------------------------------------------------------------------
+    size_t ParseUrls(std::span<const std::string> urls,
+                     std::vector<UrlOffsets> & results,
+                     unsigned int maxThreads = 0);
+
+    //------------------------------------------------------------------------
+    //!  Validates each line of @c lines as a URL and stores the results in
+    //!  @c results, one per line so that results[n] is line n+1.  A
+    //!  trailing '\r' is not part of the URL, and blank lines are
+    //!  invalid.  Like ParseUrls(), large inputs are split across up to
+    //!  @c maxThreads threads.  Returns the number of valid URLs.
+    //------------------------------------------------------------------------
+    size_t ParseUrlLines(std::string_view lines,
+                         std::vector<UrlOffsets> & results,
+                         unsigned int maxThreads = 0);
+
+    //------------------------------------------------------------------------
+    //!  A read-only memory-mapped file, for handing a large URL list to
+    //!  ParseUrlLines() without reading it into memory first.
+    //------------------------------------------------------------------------
+    class MappedFile
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      MappedFile() = default;
+
+      //----------------------------------------------------------------------
+      //!  Unmaps the file.
+      //----------------------------------------------------------------------
+      ~MappedFile();
+
+      MappedFile(const MappedFile &) = delete;
+      MappedFile & operator = (const MappedFile &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Maps the file at @c path.  Returns true on success, false on
+      //!  failure.
+      //----------------------------------------------------------------------
+      bool Open(const std::string & path);
+
+      //----------------------------------------------------------------------
+      //!  Unmaps the file.
+      //----------------------------------------------------------------------
+      void Close();
+
+      //----------------------------------------------------------------------
+      //!  Returns the contents of the file.  Empty if the file isn't open.
+      //----------------------------------------------------------------------
+      std::string_view Data() const
+      { return std::string_view(_data, _size); }
+      
+    private:
+      const char  *_data = nullptr;
+      size_t       _size = 0;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSURLBATCH_HH_
@@ -0,0 +1,139 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrlTable.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::UrlTable class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSURLTABLE_HH_
+#define _DWMWEBUTILSURLTABLE_HH_
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "DwmWebUtilsUrl.hh"
+#include "DwmWebUtilsUrlView.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Interns URLs: each distinct normalized URL (see Url::Normalize())
+    //!  is stored once and given a small integer ID, so URLs can be
+    //!  compared, hashed and stored as IDs.  IDs are assigned in order
+    //!  from 0 and are never reused until Clear().  All members are
+    //!  thread safe.
+    //------------------------------------------------------------------------
+    class UrlTable
+    {
+    public:
+      using Id = uint32_t;
+
+      //----------------------------------------------------------------------
+      //!  The ID returned when a URL can't be interned or isn't found.
+      //----------------------------------------------------------------------
+      static constexpr Id  k_noId = UINT32_MAX;
+      
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      UrlTable() = default;
+
+      UrlTable(const UrlTable &) = delete;
+      UrlTable & operator = (const UrlTable &) = delete;
+      
+      //----------------------------------------------------------------------
+      //!  Normalizes @c url and returns its ID, adding it to the table if
+      //!  it's not already there.
+      //----------------------------------------------------------------------
+      Id Intern(Url url);
+
+      //----------------------------------------------------------------------
+      //!  Parses and normalizes @c url and returns its ID, adding it to
+      //!  the table if it's not already there.  Returns k_noId if @c url
+      //!  can't be parsed.
+      //----------------------------------------------------------------------
+      Id Intern(std::string_view url);
+
+      //----------------------------------------------------------------------
+      //!  Just like Intern(std::string_view) above.  These resolve what
+      //!  would otherwise be ambiguous between Url and std::string_view.
+      //----------------------------------------------------------------------
+      Id Intern(const std::string & url)
+      { return Intern(std::string_view(url)); }
+
+      Id Intern(const char *url)
+      { return Intern(std::string_view(url)); }
+
+      //----------------------------------------------------------------------
+      //!  Returns the ID of @c url (after normalizing it), or k_noId if
+      //!  it's not in the table.
+      //----------------------------------------------------------------------
+      Id Find(Url url) const;
+      
+      //----------------------------------------------------------------------
+      //!  Returns the normalized URL with the given @c id.  The reference
+      //!  is good until Clear() is called.  Throws std::out_of_range if
+      //!  there's no such ID.
+      //----------------------------------------------------------------------
+      const Url & Get(Id id) const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the number of URLs in the table.
+      //----------------------------------------------------------------------
+      size_t Size() const;
+
+      //----------------------------------------------------------------------
+      //!  Removes all URLs from the table.
+      //----------------------------------------------------------------------
+      void Clear();
+      
+    private:
+      mutable std::mutex                  _mtx;
+      std::deque<Url>                     _urls;
+      std::unordered_map<UrlView,Id>      _ids;
+    };
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
+
+#endif  // _DWMWEBUTILSURLTABLE_HH_
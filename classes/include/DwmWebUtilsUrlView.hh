@@ -0,0 +1,249 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrlView.hh
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::UrlView class declaration
+//---------------------------------------------------------------------------
+
+#ifndef _DWMWEBUTILSURLVIEW_HH_
+#define _DWMWEBUTILSURLVIEW_HH_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "DwmWebUtilsUrl.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  A parsed URL that doesn't own its characters: each component is a
+    //!  std::string_view into the string that was parsed (or into the Url
+    //!  it was constructed from).  Parsing into a UrlView never touches
+    //!  the heap, and copying one is a handful of pointer copies, so it's
+    //!  suited to picking apart URLs from logs, routing and the like.
+    //!  The string that was parsed must outlive the UrlView and must not
+    //!  be modified while the UrlView is in use.  Use Url(const UrlView &)
+    //!  to get an owning copy.
+    //!
+    //!  Accepts exactly the URLs that Url::Parse() accepts, with the same
+    //!  default port and path.
+    //------------------------------------------------------------------------
+    class UrlView
+    {
+    public:
+      //----------------------------------------------------------------------
+      //!  Default constructor
+      //----------------------------------------------------------------------
+      UrlView() = default;
+
+      //----------------------------------------------------------------------
+      //!  Convenience constructor to construct from a string.  Throws
+      //!  std::invalid_argument if @c url can't be parsed.
+      //----------------------------------------------------------------------
+      explicit UrlView(std::string_view url);
+
+      //----------------------------------------------------------------------
+      //!  Just like UrlView(std::string_view) above.  @c url must outlive
+      //!  the UrlView.
+      //----------------------------------------------------------------------
+      explicit UrlView(const std::string & url)
+          : UrlView(std::string_view(url))
+      {}
+
+      //----------------------------------------------------------------------
+      //!  Construct a view of @c url.  @c url must outlive the UrlView.
+      //----------------------------------------------------------------------
+      UrlView(const Url & url);
+
+      //----------------------------------------------------------------------
+      //!  Parses @c url and stores views of the parsed components in
+      //!  @c this.  Returns true on success, false on failure.
+      //----------------------------------------------------------------------
+      bool Parse(std::string_view url);
+
+      //----------------------------------------------------------------------
+      //!  Clears the UrlView (sets the contents the same as the default
+      //!  constructor).
+      //----------------------------------------------------------------------
+      void Clear();
+    
+      //----------------------------------------------------------------------
+      //!  Returns the scheme portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Scheme() const
+      { return _scheme; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the scheme portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Scheme(std::string_view scheme)
+      { return _scheme = scheme; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the user info portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view UserInfo() const
+      { return _userinfo; }
+
+      //----------------------------------------------------------------------
+      //!  Sets and returns the user info portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view UserInfo(std::string_view userinfo)
+      { return _userinfo = userinfo; }
+
+      //----------------------------------------------------------------------
+      //!  Returns the host portion of the URL.  An IPv6 address is
+      //!  returned without its brackets.
+      //----------------------------------------------------------------------
+      std::string_view Host() const
+      { return _host; }
+    
+      //----------------------------------------------------------------------
+      //!  Sets and returns the host portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Host(std::string_view host)
+      { return _host = host; }
+    
+      //----------------------------------------------------------------------
+      //!  Returns the port portion of the URL.  If the URL had no port,
+      //!  this is the default port for the scheme.
+      //----------------------------------------------------------------------
+      uint16_t Port() const
+      { return _port; }
+    
+      //----------------------------------------------------------------------
+      //!  Sets and returns the port portion of the URL.
+      //----------------------------------------------------------------------
+      uint16_t Port(uint16_t port)
+      { return _port = port; }
+    
+      //----------------------------------------------------------------------
+      //!  Returns the path portion of the URL.  If the URL had no path,
+      //!  this is "/".
+      //----------------------------------------------------------------------
+      std::string_view Path() const
+      { return _path; }
+    
+      //----------------------------------------------------------------------
+      //!  Sets and returns the path portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Path(std::string_view path)
+      { return _path = path; }
+    
+      //----------------------------------------------------------------------
+      //!  Returns the query portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Query() const
+      { return _query; }
+    
+      //----------------------------------------------------------------------
+      //!  Sets and returns the query portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Query(std::string_view query)
+      { return _query = query; }
+    
+      //----------------------------------------------------------------------
+      //!  Returns the fragment portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Fragment() const
+      { return _fragment; }
+    
+      //----------------------------------------------------------------------
+      //!  Sets and returns the fragment portion of the URL.
+      //----------------------------------------------------------------------
+      std::string_view Fragment(std::string_view fragment)
+      { return _fragment = fragment; }
+
+      //----------------------------------------------------------------------
+      //!  Convenience member that returns a string of the form
+      //!  'path?query#fragment'
+      //----------------------------------------------------------------------
+      std::string AfterAuthority() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the URL as a string.  The port is always included unless
+      //!  @c elideDefaultPort is true and the port is the default for the
+      //!  scheme.
+      //----------------------------------------------------------------------
+      std::string to_string(bool elideDefaultPort = false) const;
+
+      //----------------------------------------------------------------------
+      //!  Returns a hash of the components, the same as
+      //!  std::hash<UrlView>.
+      //----------------------------------------------------------------------
+      size_t Hash() const;
+
+      //----------------------------------------------------------------------
+      //!  Returns the default port for @c scheme, or 0 if we don't know
+      //!  it.
+      //----------------------------------------------------------------------
+      static uint16_t DefaultPort(std::string_view scheme);
+
+      //----------------------------------------------------------------------
+      //!  Equality comparison operator.  Compares the components, not
+      //!  where they point.
+      //----------------------------------------------------------------------
+      bool operator == (const UrlView & urlView) const;
+      
+    private:
+      std::string_view  _scheme;
+      std::string_view  _userinfo;
+      std::string_view  _host;
+      uint16_t          _port = 0;
+      std::string_view  _path;
+      std::string_view  _query;
+      std::string_view  _fragment;
+    };
+
+  }  // namespace WebUtils
+  
+}  // namespace Dwm
+
+//----------------------------------------------------------------------------
+//!  So UrlViews can be used as keys in unordered containers.
+//----------------------------------------------------------------------------
+template <>
+struct std::hash<Dwm::WebUtils::UrlView>
+{
+  size_t operator () (const Dwm::WebUtils::UrlView & urlView) const noexcept
+  { return urlView.Hash(); }
+};
+
+#endif  // _DWMWEBUTILSURLVIEW_HH_
@@ -39,269 +39,346 @@
 //!  \brief Dwm::WebUtils function implementations
 //---------------------------------------------------------------------------
 
+#include <algorithm>
+#include <exception>
 #include <iostream>
-#include <regex>
 #include <string_view>
 
-#include <boost/asio.hpp>
-#include <boost/certify/extensions.hpp>
-#include <boost/certify/https_verification.hpp>
-
 #include "DwmSysLogger.hh"
 #include "DwmWebUtilsUrl.hh"
+#include "DwmWebUtilsUrlView.hh"
 #include "DwmWebUtils.hh"
+#include "DwmWebUtilsAsync.hh"
+#include "DwmWebUtilsFastJson.hh"
+#include "DwmWebUtilsJsonProjection.hh"
+#include "DwmWebUtilsResponseCache.hh"
 
 namespace Dwm {
 
   namespace WebUtils {
 
-    namespace beast = boost::beast;
     namespace asio = boost::asio;
-    namespace ssl = asio::ssl;
-    using tcp = boost::asio::ip::tcp;
 
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static tcp::resolver::results_type
-    resolve(asio::io_context& ctx, std::string const & hostname,
-            const std::string & service)
+    static bool ParseUrl(const std::string & urlstr, Url & url,
+                         GetFailure & failure)
     {
-      tcp::resolver resolver{ctx};
-      return resolver.resolve(hostname, service);
+      bool  rc = false;
+      if (url.Parse(urlstr)) {
+        if ((url.Scheme() == "https") || (url.Scheme() == "http")) {
+          rc = true;
+        }
+        else {
+          failure.FailNum(GetFailure::k_failNumURL);
+          Syslog(LOG_ERR, "Unhandled URL scheme '%s'", url.Scheme().c_str());
+        }
+      }
+      else {
+        failure.FailNum(GetFailure::k_failNumURL);
+        Syslog(LOG_ERR, "Failed to parse URL '%s'", urlstr.c_str());
+      }
+      return rc;
     }
 
     //------------------------------------------------------------------------
-    //!  
+    //!  Like ParseUrl() above, for a URL that's already been parsed.
     //------------------------------------------------------------------------
-    static tcp::socket
-    Connect(asio::io_context & ctx, std::string const & hostname,
-            const std::string & service)
+    static bool ParseUrl(const UrlView & urlView, Url & url,
+                         GetFailure & failure)
     {
-      tcp::socket socket{ctx};
-      asio::connect(socket, resolve(ctx, hostname, service));
-      return socket;
+      bool  rc = false;
+      if ((urlView.Scheme() == "https") || (urlView.Scheme() == "http")) {
+        if (! urlView.Host().empty()) {
+          url = urlView;
+          rc = true;
+        }
+        else {
+          failure.FailNum(GetFailure::k_failNumURL);
+          Syslog(LOG_ERR, "No host in URL");
+        }
+      }
+      else {
+        failure.FailNum(GetFailure::k_failNumURL);
+        Syslog(LOG_ERR, "Unhandled URL scheme '%.*s'",
+               (int)urlView.Scheme().size(), urlView.Scheme().data());
+      }
+      return rc;
     }
 
     //------------------------------------------------------------------------
-    //!  
+    //!  Marks the end of JSON parsing in the metrics from @c options, if
+    //!  there are any and we got as far as reading the body.
     //------------------------------------------------------------------------
-    static std::unique_ptr<ssl::stream<tcp::socket>>
-    Connect(asio::io_context & ctx, ssl::context & ssl_ctx,
-            std::string const & hostname, const std::string & service)
+    static void MarkParsed(const RequestOptions & options)
     {
-      std::unique_ptr<ssl::stream<tcp::socket>>  rc(nullptr);
-      try {
-        tcp::socket  sock = Connect(ctx, hostname, service);
-        rc = boost::make_unique<ssl::stream<tcp::socket>>(std::move(sock),
-                                                          ssl_ctx);
-        Syslog(LOG_INFO, "Connected to %s:%s", hostname.c_str(),
-               service.c_str());
-      }
-      catch (...) {
-        rc = nullptr;
-        Syslog(LOG_ERR, "Failed to connect to %s:%s", hostname.c_str(),
-               service.c_str());
+      auto  metrics = options.Metrics();
+      if (metrics && metrics->Reached(RequestMetrics::e_bodyDone)) {
+        metrics->Mark(RequestMetrics::e_parseDone);
       }
-      return rc;
+      return;
     }
-
+    
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool HttpsHandshake(ssl::stream<tcp::socket> * strm,
-                               std::string const & hostname)
+    static bool ParseJson(const http::response<http::string_body> & response,
+                          nlohmann::json & json, GetFailure & failure)
     {
       bool  rc = false;
-      assert(strm);
-      try {
-        boost::certify::set_server_hostname(*strm, hostname);
-        boost::certify::sni_hostname(*strm, hostname);
-        strm->handshake(ssl::stream_base::handshake_type::client);
+      json = nlohmann::json::parse(response.body(), nullptr, false);
+      if (! json.is_discarded()) {
+        failure.FailNum(GetFailure::k_failNumNone);
         rc = true;
       }
-      catch (...) {
-        Syslog(LOG_ERR, "HTTPS handshake with %s failed", hostname.c_str());
+      else {
+        failure.FailNum(GetFailure::k_failNumJSON);
       }
       return rc;
     }
-    
+
     //------------------------------------------------------------------------
-    //!  
+    //!  Like ParseJson() above, for a response that went through @c cache.
+    //!  If the cache entry for @c url already holds the parsed JSON (the
+    //!  response came from the cache or was revalidated), we use it
+    //!  instead of parsing again.  Else we parse the body and keep the
+    //!  result in the cache entry, if there is one.  Like the uncached
+    //!  path, we don't fail on the status code; only 200 responses are
+    //!  cached, so any other response is just parsed.
     //------------------------------------------------------------------------
-    template <typename T>
-    static http::response<http::string_body>
-    Get(T & stream, std::string_view hostname, std::string_view urlstr)
+    static bool ParseJson(const Url & url,
+                          const http::response<http::string_body> & response,
+                          nlohmann::json & json, GetFailure & failure,
+                          ResponseCache & cache)
     {
-      http::request<http::string_body> request;
-      request.method(http::verb::get);
-      request.target(urlstr);
-      request.keep_alive(false);
-      request.set(http::field::host, hostname);
-      request.set(http::field::user_agent, "mcrover/1.0");
-      http::write(stream, request);
-      http::response<http::string_body> response;
-      beast::flat_buffer buffer;
-      http::read(stream, buffer, response);
-      
-      return response;
+      if (response.result() != http::status::ok) {
+        return ParseJson(response, json, failure);
+      }
+      auto  key = ResponseCache::Key(url.to_string());
+      if (cache.FindJson(key, json)) {
+        failure.FailNum(GetFailure::k_failNumNone);
+        return true;
+      }
+      bool  rc = ParseJson(response, json, failure);
+      if (rc) {
+        cache.StoreJson(key, json);
+      }
+      return rc;
     }
-
+    
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool
-    GetResponseViaHttp(const Url & url,
-                       http::response<http::string_body> & response,
-                       GetFailure & failure)
+    template <typename Response>
+    static asio::awaitable<bool>
+    AsyncGetResponse(const Url & url, Response & response,
+                     GetFailure & failure, const RequestOptions & options,
+                     bool verifyCertificate)
     {
+      Connection  connection(ConnectionKey(url, verifyCertificate),
+                             co_await asio::this_coro::executor);
+      connection.Options(options);
       bool  rc = false;
-      asio::io_context ctx;
-      beast::tcp_stream stream(ctx);
-      try {
-        stream.connect(resolve(ctx, url.Host(), std::to_string(url.Port())));
-      }
-      catch (...) {
-        failure.FailNum(GetFailure::k_failNumConnect);
-        return false;
+      if (co_await connection.AsyncOpen(failure)) {
+        rc = co_await connection.AsyncGet(url, response, failure, false);
       }
-
-      try {
-        response = Get(stream, url.Host(), url.AfterAuthority());
-        failure.FailNum(GetFailure::k_failNumNone);
-        rc = true;
-      }
-      catch (...) {
-        failure.FailNum((response.result() == http::status::ok)
-                        ? GetFailure::k_failNumGet : response.result_int());
-      }
-      
-      beast::error_code ec;
-      stream.socket().shutdown(tcp::socket::shutdown_both, ec);
-    
-      return rc;
+      co_await connection.AsyncClose();
+      co_return rc;
     }
 
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool
-    GetResponseViaHttp(const Url & url,
-                       http::response<http::string_body> & response)
+    static asio::awaitable<bool>
+    AsyncGetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & failure, const RequestOptions & options,
+                     bool verifyCertificate)
     {
-      GetFailure  failure;
-      return GetResponseViaHttp(url, response, failure);
+      bool  rc = false;
+      Url   url;
+      if (ParseUrl(urlstr, url, failure)) {
+        rc = co_await AsyncGetResponse(url, response, failure, options,
+                                       verifyCertificate);
+      }
+      co_return rc;
     }
 
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static void InitializeSSLContext(ssl::context & sslctx, bool verifyCert)
+    static asio::awaitable<bool>
+    AsyncGetStream(const Url & url, http::response_header<> & header,
+                   const BodyCallback & onBody, GetFailure & failure,
+                   const RequestOptions & options, bool verifyCertificate)
     {
-      if (verifyCert) {
-        sslctx.set_verify_mode(ssl::context::verify_peer |
-                               ssl::context::verify_fail_if_no_peer_cert);
-      }
-      else {
-        sslctx.set_verify_mode(ssl::verify_none);
+      Connection  connection(ConnectionKey(url, verifyCertificate),
+                             co_await asio::this_coro::executor);
+      connection.Options(options);
+      bool  rc = false;
+      if (co_await connection.AsyncOpen(failure)) {
+        rc = co_await connection.AsyncGet(url, header, onBody, failure,
+                                          false);
       }
-      sslctx.set_default_verify_paths();
-      boost::certify::enable_native_https_server_verification(sslctx);
-      return;
+      co_await connection.AsyncClose();
+      co_return rc;
     }
-    
+
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool 
-    GetResponseViaHttps(const Url & url,
-                        http::response<http::string_body> & response,
-                        GetFailure & failure, bool verifyCertificate)
+    static asio::awaitable<bool>
+    AsyncGetToFile(const Url & url, const std::string & path,
+                   TransferStats & stats, GetFailure & failure,
+                   const RequestOptions & options, bool resume,
+                   bool verifyCertificate)
     {
+      Connection  connection(ConnectionKey(url, verifyCertificate),
+                             co_await asio::this_coro::executor);
+      connection.Options(options);
       bool  rc = false;
-      asio::io_context ctx;
-      ssl::context ssl_ctx{ssl::context::tls_client};
-      InitializeSSLContext(ssl_ctx, verifyCertificate);
-
-      std::unique_ptr<ssl::stream<tcp::socket>>  stream_ptr;
-      try {
-        stream_ptr = Connect(ctx, ssl_ctx, url.Host(),
-                             std::to_string(url.Port()));
-        if (! stream_ptr) {
-          failure.FailNum(GetFailure::k_failNumConnect);
-          return false;
-        }
+      if (co_await connection.AsyncOpen(failure)) {
+        rc = co_await connection.AsyncGetToFile(url, path, resume, stats,
+                                                failure, false);
       }
-      catch (...) {
-        failure.FailNum(GetFailure::k_failNumConnect);
-        return false;
+      co_await connection.AsyncClose();
+      co_return rc;
+    }
+    
+    namespace Detail {
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<std::tuple<GetFailure,http::response<http::string_body>>>
+      CoGetResponse(std::string urlstr, RequestOptions options,
+                    bool verifyCertificate)
+      {
+        std::tuple<GetFailure,http::response<http::string_body>>  rc;
+        co_await AsyncGetResponse(urlstr, std::get<1>(rc), std::get<0>(rc),
+                                  options, verifyCertificate);
+        co_return rc;
       }
 
-      if (HttpsHandshake(stream_ptr.get(), url.Host())) {
-        try {
-          response = Get(*stream_ptr, url.Host(), url.AfterAuthority());
-          failure.FailNum(GetFailure::k_failNumNone);
-          rc = true;
-        }
-        catch (...) {
-          failure.FailNum((response.result() == http::status::ok)
-                          ? GetFailure::k_failNumGet : response.result_int());
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<std::tuple<GetFailure,nlohmann::json>>
+      CoGetJson(std::string urlstr, RequestOptions options,
+                bool verifyCertificate)
+      {
+        std::tuple<GetFailure,nlohmann::json>  rc;
+        http::response<http::string_body>      response;
+        Url                                    url;
+        if (ParseUrl(urlstr, url, std::get<0>(rc))
+            && co_await AsyncGetResponse(url, response, std::get<0>(rc),
+                                         options, verifyCertificate)) {
+          if (options.Cache()) {
+            ParseJson(url, response, std::get<1>(rc), std::get<0>(rc),
+                      *options.Cache());
+          }
+          else {
+            ParseJson(response, std::get<1>(rc), std::get<0>(rc));
+          }
+          MarkParsed(options);
         }
-      }
-      else {
-        failure.FailNum(GetFailure::k_failNumAuth);
+        co_return rc;
       }
 
-      if (stream_ptr) {
-        boost::system::error_code  ec;
-        stream_ptr->shutdown(ec);
-        stream_ptr->next_layer().close(ec);
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<std::tuple<GetFailure,int>>
+      CoGetStatus(std::string urlstr, RequestOptions options,
+                  bool verifyCertificate)
+      {
+        std::tuple<GetFailure,int>         rc(GetFailure(), -1);
+        http::response<http::string_body>  response;
+        if (co_await AsyncGetResponse(urlstr, response, std::get<0>(rc),
+                                      options, verifyCertificate)) {
+          std::get<1>(rc) = response.result_int();
+        }
+        co_return rc;
       }
+      
+    }  // namespace Detail
+
+    //------------------------------------------------------------------------
+    //!  Runs @c op to completion on a private io_context.  If @c op
+    //!  throws, logs the exception and sets @c failure to
+    //!  @c GetFailure::k_failNumUnknown.
+    //------------------------------------------------------------------------
+    static bool RunSync(asio::awaitable<bool> && op, GetFailure & failure)
+    {
+      asio::io_context  ioc;
+      bool  rc = false;
+      asio::co_spawn(ioc, std::move(op),
+                     [&] (std::exception_ptr ep, bool result) {
+                       if (! ep) {
+                         rc = result;
+                         return;
+                       }
+                       try {
+                         std::rethrow_exception(ep);
+                       }
+                       catch (const std::exception & ex) {
+                         Syslog(LOG_ERR, "Exception during request: %s",
+                                ex.what());
+                       }
+                       catch (...) {
+                         Syslog(LOG_ERR, "Unknown exception during request");
+                       }
+                       failure.FailNum(GetFailure::k_failNumUnknown);
+                     });
+      ioc.run();
       return rc;
     }
     
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool 
-    GetResponseViaHttps(const Url & url,
-                        http::response<http::string_body> & response,
-                        bool verifyCertificate)
+    static bool GetResponse(const Url & url,
+                            http::response<http::string_body> & response,
+                            GetFailure & getFail, ConnectionPool * pool,
+                            const RequestOptions & options,
+                            bool verifyCertificate)
     {
-      GetFailure  failure;
-      return GetResponseViaHttps(url, response, failure, verifyCertificate);
+      if (pool) {
+        return pool->Get(url, response, getFail, options, verifyCertificate);
+      }
+      return RunSync(AsyncGetResponse(url, response, getFail, options,
+                                      verifyCertificate), getFail);
     }
 
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool GetResponse(const Url & url,
+    template <typename UrlArg>
+    static bool GetResponse(const UrlArg & urlArg,
                             http::response<http::string_body> & response,
-                            GetFailure & failure, bool verifyCertificate)
+                            GetFailure & getFail, ConnectionPool * pool,
+                            const RequestOptions & options,
+                            bool verifyCertificate)
     {
       bool  rc = false;
-      if (url.Scheme() == "https") {
-        rc = GetResponseViaHttps(url, response, failure, verifyCertificate);
-      }
-      else if (url.Scheme() == "http") {
-        rc = GetResponseViaHttp(url, response, failure);
-      }
-      else {
-        failure.FailNum(GetFailure::k_failNumURL);
-        Syslog(LOG_ERR, "Unhandled URL scheme '%s'", url.Scheme().c_str());
+      Url  url;
+      if (ParseUrl(urlArg, url, getFail)) {
+        rc = GetResponse(url, response, getFail, pool, options,
+                         verifyCertificate);
       }
       return rc;
     }
-    
+
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    static bool GetResponse(const Url & url,
-                            http::response<http::string_body> & response,
-                            bool verifyCertificate)
+    bool GetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFail, bool verifyCertificate)
     {
-      GetFailure  failure;
-      return GetResponse(url, response, failure, verifyCertificate);
+      return GetResponse(urlstr, response, getFail, nullptr,
+                         RequestOptions(), verifyCertificate);
     }
 
     //------------------------------------------------------------------------
@@ -309,20 +386,37 @@ namespace Dwm {
     //------------------------------------------------------------------------
     bool GetResponse(const std::string & urlstr,
                      http::response<http::string_body> & response,
-                     GetFailure & getFail, bool verifyCertificate)
+                     GetFailure & getFail, ConnectionPool & pool,
+                     bool verifyCertificate)
     {
-      bool  rc = false;
-      Url  url;
-      if (url.Parse(urlstr)) {
-        rc = GetResponse(url, response, getFail, verifyCertificate);
-      }
-      else {
-        getFail.FailNum(GetFailure::k_failNumURL);
-        Syslog(LOG_ERR, "Failed to parse URL '%s'", urlstr.c_str());
-      }
-      return rc;
+      return GetResponse(urlstr, response, getFail, &pool,
+                         RequestOptions(), verifyCertificate);
     }
 
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFail, const RequestOptions & options,
+                     bool verifyCertificate)
+    {
+      return GetResponse(urlstr, response, getFail, nullptr, options,
+                         verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFail, ConnectionPool & pool,
+                     const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetResponse(urlstr, response, getFail, &pool, options,
+                         verifyCertificate);
+    }
+    
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
@@ -337,71 +431,494 @@ namespace Dwm {
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
-    int GetStatus(const std::string & urlstr, GetFailure & failure,
-                  bool verifyCertificate)
+    template <typename UrlArg>
+    static int GetStatus(const UrlArg & urlArg, GetFailure & failure,
+                         ConnectionPool * pool,
+                         const RequestOptions & options,
+                         bool verifyCertificate)
     {
       int  rc = -1;
-      Url  url;
-      if (url.Parse(urlstr)) {
-        http::response<http::string_body>  response;
-        if (GetResponse(url, response, failure, verifyCertificate)) {
-          rc = response.result_int();
-          failure.FailNum(GetFailure::k_failNumNone);
-        }
-      }
-      else {
-        failure.FailNum(GetFailure::k_failNumURL);
-        Syslog(LOG_ERR, "Failed to parse URL '%s'", urlstr.c_str());
+      http::response<http::string_body>  response;
+      if (GetResponse(urlArg, response, failure, pool, options,
+                      verifyCertificate)) {
+        rc = response.result_int();
       }
       return rc;
     }
 
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & failure,
+                  bool verifyCertificate)
+    {
+      return GetStatus(urlstr, failure, nullptr, RequestOptions(),
+                       verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & failure,
+                  ConnectionPool & pool, bool verifyCertificate)
+    {
+      return GetStatus(urlstr, failure, &pool, RequestOptions(),
+                       verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & failure,
+                  const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetStatus(urlstr, failure, nullptr, options, verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int GetStatus(const std::string & urlstr, GetFailure & failure,
+                  ConnectionPool & pool, const RequestOptions & options,
+                  bool verifyCertificate)
+    {
+      return GetStatus(urlstr, failure, &pool, options, verifyCertificate);
+    }
+    
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
     int GetStatus(const std::string & urlstr, bool verifyCertificate)
     {
-      int  rc = -1;
-      Url  url;
-      if (url.Parse(urlstr)) {
+      GetFailure  failure;
+      return GetStatus(urlstr, failure, nullptr, RequestOptions(),
+                       verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename UrlArg>
+    static bool GetBody(const UrlArg & urlArg, const BodyReader & reader,
+                        GetFailure & getFailure, ConnectionPool * pool,
+                        const RequestOptions & options,
+                        bool verifyCertificate)
+    {
+      bool  rc = false;
+      Url   url;
+      if (ParseUrl(urlArg, url, getFailure)) {
+        http::response_header<>  header;
+        if (pool) {
+          rc = pool->Get(url, header, reader, getFailure, options,
+                         verifyCertificate);
+        }
+        else {
+          Connection  connection(ConnectionKey(url, verifyCertificate));
+          connection.Options(options);
+          rc = connection.Get(url, header, reader, getFailure, false);
+          connection.Close();
+        }
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Parses the JSON as the body arrives, so we never hold the whole
+    //!  body and the DOM at the same time.
+    //------------------------------------------------------------------------
+    template <typename UrlArg>
+    static bool GetJson(const UrlArg & urlArg, nlohmann::json & json,
+                        GetFailure & getFailure, ConnectionPool * pool,
+                        const RequestOptions & options,
+                        bool verifyCertificate)
+    {
+      if (options.Cache()) {
+        //  The cache holds whole responses, so buffer the body.
+        bool  rc = false;
+        Url   url;
         http::response<http::string_body>  response;
-        if (GetResponse(url, response, verifyCertificate)) {
-          rc = response.result_int();
+        if (ParseUrl(urlArg, url, getFailure)
+            && GetResponse(url, response, getFailure, pool, options,
+                           verifyCertificate)) {
+          rc = ParseJson(url, response, json, getFailure, *options.Cache());
+          MarkParsed(options);
         }
+        return rc;
       }
-      else {
-        Syslog(LOG_ERR, "Failed to parse URL '%s'", urlstr.c_str());
+      
+      nlohmann::json  parsed;
+      auto  parse = [&] (std::istream & body) {
+        parsed = nlohmann::json::parse(body, nullptr, false);
+        if (parsed.is_discarded()) {
+          getFailure.FailNum(GetFailure::k_failNumJSON);
+          return false;
+        }
+        return true;
+      };
+      bool  rc = GetBody(urlArg, parse, getFailure, pool, options,
+                         verifyCertificate);
+      MarkParsed(options);
+      if (rc) {
+        json = std::move(parsed);
       }
       return rc;
     }
 
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static bool GetJson(const std::string & urlstr,
+                        nlohmann::json_sax<nlohmann::json> & sax,
+                        GetFailure & getFailure, ConnectionPool * pool,
+                        const RequestOptions & options,
+                        bool verifyCertificate)
+    {
+      auto  parse = [&] (std::istream & body) {
+        if (! nlohmann::json::sax_parse(body, &sax)) {
+          getFailure.FailNum(GetFailure::k_failNumJSON);
+          return false;
+        }
+        return true;
+      };
+      bool  rc = GetBody(urlstr, parse, getFailure, pool, options,
+                         verifyCertificate);
+      MarkParsed(options);
+      return rc;
+    }
+
     //------------------------------------------------------------------------
     //!  
     //------------------------------------------------------------------------
     bool GetJson(const std::string & urlstr, nlohmann::json & json,
                  GetFailure & getFailure, bool verifyCertificate)
     {
-      bool  rc = false;
-      Url  url;
-      if (url.Parse(urlstr)) {
-        http::response<http::string_body>  response;
-        if (GetResponse(url, response, getFailure, verifyCertificate)) {
-          json = nlohmann::json::parse(response.body(), nullptr, false);
-          if (! json.is_discarded()) {
-            getFailure.FailNum(GetFailure::k_failNumNone);
-            rc = true;
+      return GetJson(urlstr, json, getFailure, nullptr, RequestOptions(),
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, &pool, RequestOptions(),
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, nullptr, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, nlohmann::json & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, &pool, options,
+                     verifyCertificate);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static bool GetJson(const std::string & urlstr,
+                        const std::vector<std::string> & pointers,
+                        nlohmann::json & json, GetFailure & getFailure,
+                        ConnectionPool * pool,
+                        const RequestOptions & options,
+                        bool verifyCertificate)
+    {
+      JsonProjection  projection(pointers);
+      bool  rc = GetJson(urlstr, projection, getFailure, pool, options,
+                         verifyCertificate);
+      if (rc) {
+        json = std::move(projection.Result());
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Reads the body straight into the FastJson's buffer, leaving room
+    //!  for the padding it needs so Parse() doesn't have to copy.
+    //------------------------------------------------------------------------
+    static bool GetJson(const std::string & urlstr, FastJson & json,
+                        GetFailure & getFailure, ConnectionPool * pool,
+                        const RequestOptions & options,
+                        bool verifyCertificate)
+    {
+      auto  parse = [&] (std::istream & body) {
+        std::string  & buffer = json.Buffer();
+        size_t  len = 0;
+        buffer.clear();
+        for (;;) {
+          if ((buffer.size() - len) < (Connection::k_bodyChunkSize / 2)) {
+            buffer.resize(std::max(buffer.size() * 2,
+                                   len + Connection::k_bodyChunkSize));
           }
-          else {
-            getFailure.FailNum(GetFailure::k_failNumJSON);
+          std::streamsize  n = body.rdbuf()->sgetn(buffer.data() + len,
+                                                   buffer.size() - len);
+          if (n <= 0) {
+            break;
           }
+          len += n;
+        }
+        buffer.resize(len);
+        if (! json.Parse()) {
+          getFailure.FailNum(GetFailure::k_failNumJSON);
+          return false;
+        }
+        return true;
+      };
+      bool  rc = GetBody(urlstr, parse, getFailure, pool, options,
+                         verifyCertificate);
+      MarkParsed(options);
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, bool verifyCertificate)
+    {
+      return GetJson(urlstr, sax, getFailure, nullptr, RequestOptions(),
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, sax, getFailure, &pool, RequestOptions(),
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, sax, getFailure, nullptr, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 nlohmann::json_sax<nlohmann::json> & sax,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetJson(urlstr, sax, getFailure, &pool, options,
+                     verifyCertificate);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, pointers, json, getFailure, nullptr,
+                     RequestOptions(), verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 ConnectionPool & pool, bool verifyCertificate)
+    {
+      return GetJson(urlstr, pointers, json, getFailure, &pool,
+                     RequestOptions(), verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetJson(urlstr, pointers, json, getFailure, nullptr, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr,
+                 const std::vector<std::string> & pointers,
+                 nlohmann::json & json, GetFailure & getFailure,
+                 ConnectionPool & pool, const RequestOptions & options,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, pointers, json, getFailure, &pool, options,
+                     verifyCertificate);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, nullptr, RequestOptions(),
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, &pool, RequestOptions(),
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, nullptr, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, FastJson & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, getFailure, &pool, options,
+                     verifyCertificate);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static bool GetResponse(const std::string & urlstr,
+                            PmrResponse & response, GetFailure & getFail,
+                            ConnectionPool * pool,
+                            const RequestOptions & options,
+                            bool verifyCertificate)
+    {
+      bool  rc = false;
+      Url  url;
+      if (ParseUrl(urlstr, url, getFail)) {
+        if (pool) {
+          rc = pool->Get(url, response, getFail, options, verifyCertificate);
+        }
+        else {
+          rc = RunSync(AsyncGetResponse(url, response, getFail, options,
+                                        verifyCertificate), getFail);
         }
-      }
-      else {
-        Syslog(LOG_ERR, "Failed to parse URL '%s'", urlstr.c_str());
-        getFailure.FailNum(GetFailure::k_failNumURL);
       }
       return rc;
     }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr, PmrResponse & response,
+                     GetFailure & getFail, const RequestOptions & options,
+                     bool verifyCertificate)
+    {
+      return GetResponse(urlstr, response, getFail, nullptr, options,
+                         verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetResponse(const std::string & urlstr, PmrResponse & response,
+                     GetFailure & getFail, ConnectionPool & pool,
+                     const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetResponse(urlstr, response, getFail, &pool, options,
+                         verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static bool GetJson(const std::string & urlstr, PmrJson & json,
+                        std::pmr::memory_resource *resource,
+                        GetFailure & getFailure, ConnectionPool * pool,
+                        const RequestOptions & options,
+                        bool verifyCertificate)
+    {
+      PmrResponse  response = MakePmrResponse(resource);
+      if (! GetResponse(urlstr, response, getFailure, pool, options,
+                        verifyCertificate)) {
+        return false;
+      }
+      PmrJsonScope  scope(resource);
+      PmrJson  parsed = PmrJson::parse(response.body(), nullptr, false);
+      MarkParsed(options);
+      if (parsed.is_discarded()) {
+        getFailure.FailNum(GetFailure::k_failNumJSON);
+        return false;
+      }
+      json = std::move(parsed);
+      getFailure.FailNum(GetFailure::k_failNumNone);
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, PmrJson & json,
+                 std::pmr::memory_resource *resource,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, resource, getFailure, nullptr, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const std::string & urlstr, PmrJson & json,
+                 std::pmr::memory_resource *resource,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetJson(urlstr, json, resource, getFailure, &pool, options,
+                     verifyCertificate);
+    }
     
     //------------------------------------------------------------------------
     //!  
@@ -413,6 +930,129 @@ namespace Dwm {
       return GetJson(urlstr, json, getFailure, verifyCertificate);
     }
 
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const UrlView & urlView, nlohmann::json & json,
+                 GetFailure & getFailure, const RequestOptions & options,
+                 bool verifyCertificate)
+    {
+      return GetJson(urlView, json, getFailure, nullptr, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetJson(const UrlView & urlView, nlohmann::json & json,
+                 GetFailure & getFailure, ConnectionPool & pool,
+                 const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetJson(urlView, json, getFailure, &pool, options,
+                     verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int GetStatus(const UrlView & urlView, GetFailure & getFailure,
+                  const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetStatus(urlView, getFailure, nullptr, options,
+                       verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int GetStatus(const UrlView & urlView, GetFailure & getFailure,
+                  ConnectionPool & pool, const RequestOptions & options,
+                  bool verifyCertificate)
+    {
+      return GetStatus(urlView, getFailure, &pool, options,
+                       verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetResponse(const UrlView & urlView,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, const RequestOptions & options,
+                     bool verifyCertificate)
+    {
+      return GetResponse(urlView, response, getFailure, nullptr, options,
+                         verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetResponse(const UrlView & urlView,
+                     http::response<http::string_body> & response,
+                     GetFailure & getFailure, ConnectionPool & pool,
+                     const RequestOptions & options, bool verifyCertificate)
+    {
+      return GetResponse(urlView, response, getFailure, &pool, options,
+                         verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetStream(const std::string & urlstr,
+                   http::response_header<> & header,
+                   const BodyCallback & onBody, GetFailure & getFailure,
+                   const RequestOptions & options, bool verifyCertificate)
+    {
+      bool  rc = false;
+      Url   url;
+      if (ParseUrl(urlstr, url, getFailure)) {
+        rc = RunSync(AsyncGetStream(url, header, onBody, getFailure,
+                                    options, verifyCertificate), getFailure);
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetStream(const std::string & urlstr,
+                   http::response_header<> & header,
+                   const BodyCallback & onBody, GetFailure & getFailure,
+                   bool verifyCertificate)
+    {
+      return GetStream(urlstr, header, onBody, getFailure, RequestOptions(),
+                       verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetToFile(const std::string & urlstr, const std::string & path,
+                   TransferStats & stats, GetFailure & getFailure,
+                   const RequestOptions & options, bool resume,
+                   bool verifyCertificate)
+    {
+      bool  rc = false;
+      Url   url;
+      if (ParseUrl(urlstr, url, getFailure)) {
+        rc = RunSync(AsyncGetToFile(url, path, stats, getFailure, options,
+                                    resume, verifyCertificate), getFailure);
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool GetToFile(const std::string & urlstr, const std::string & path,
+                   TransferStats & stats, GetFailure & getFailure,
+                   bool resume, bool verifyCertificate)
+    {
+      return GetToFile(urlstr, path, stats, getFailure, RequestOptions(),
+                       resume, verifyCertificate);
+    }
     
   }  // namespace WebUtils
 
@@ -0,0 +1,351 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsBatch.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils batch fetch implementations
+//---------------------------------------------------------------------------
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsBatch.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace asio = boost::asio;
+
+    //------------------------------------------------------------------------
+    //!  Runs a batch of GET requests on a single io_context, keeping at
+    //!  most MaxConcurrent() requests in flight overall and MaxPerHost()
+    //!  per host, and reusing keep-alive connections per host.  Hosts are
+    //!  serviced round-robin so one host with many URLs doesn't starve
+    //!  the others.
+    //------------------------------------------------------------------------
+    class BatchRunner
+    {
+    public:
+      using Callback =
+        std::function<void(size_t, GetFailure &,
+                           http::response<http::string_body> &)>;
+
+      BatchRunner(const BatchOptions & options, Callback callback)
+          : _ioc(), _options(options), _callback(callback), _hosts(),
+            _nextHost(_hosts.end()), _pending(0), _active(0), _inFlight(),
+            _expired(false), _deadline(_ioc)
+      {}
+
+      //----------------------------------------------------------------------
+      //!  Queues @c url, whose result will be reported to the callback
+      //!  with index @c idx.  @c url must remain valid until Run()
+      //!  returns.
+      //----------------------------------------------------------------------
+      void Add(size_t idx, const Url & url)
+      {
+        ConnectionKey  key(url, _options.VerifyCertificate());
+        _hosts[key].pending.push_back({idx, &url});
+        ++_pending;
+        return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  Fetches all queued URLs, returning when all are done or the
+      //!  deadline has passed.
+      //----------------------------------------------------------------------
+      void Run()
+      {
+        if (_options.Deadline().count() > 0) {
+          _deadline.expires_after(_options.Deadline());
+          _deadline.async_wait([this] (boost::system::error_code ec)
+                               { if (! ec) { Expire(); } });
+        }
+        _nextHost = _hosts.begin();
+        Launch();
+        _ioc.run();
+        return;
+      }
+      
+    private:
+      struct Host
+      {
+        std::deque<std::pair<size_t,const Url *>>  pending;
+        size_t                                     active = 0;
+        std::vector<std::unique_ptr<Connection>>   idle;
+      };
+      using HostMap = std::map<ConnectionKey,Host>;
+      
+      asio::io_context      _ioc;
+      BatchOptions          _options;
+      Callback              _callback;
+      HostMap               _hosts;
+      HostMap::iterator     _nextHost;
+      size_t                _pending;
+      size_t                _active;
+      std::set<Connection *> _inFlight;
+      bool                  _expired;
+      asio::steady_timer    _deadline;
+
+      //----------------------------------------------------------------------
+      //!  Starts as many pending requests as our limits allow.
+      //----------------------------------------------------------------------
+      void Launch()
+      {
+        while ((! _expired) && _pending
+               && (_active < _options.MaxConcurrent())) {
+          HostMap::iterator  hit = _hosts.end();
+          for (size_t i = 0; i < _hosts.size(); ++i) {
+            if (_nextHost == _hosts.end()) {
+              _nextHost = _hosts.begin();
+            }
+            HostMap::iterator  candidate = _nextHost++;
+            if ((! candidate->second.pending.empty())
+                && (candidate->second.active < _options.MaxPerHost())) {
+              hit = candidate;
+              break;
+            }
+          }
+          if (hit == _hosts.end()) {
+            break;  // every host with pending URLs is at its limit
+          }
+          auto  [idx, url] = hit->second.pending.front();
+          hit->second.pending.pop_front();
+          --_pending;
+          ++hit->second.active;
+          ++_active;
+          asio::co_spawn(_ioc, Fetch(hit->first, hit->second, idx, *url),
+                         asio::detached);
+        }
+        if ((! _active) && ((! _pending) || _expired)) {
+          _deadline.cancel();
+        }
+        return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<void> Fetch(const ConnectionKey & key, Host & host,
+                                  size_t idx, const Url & url)
+      {
+        std::unique_ptr<Connection>  connection;
+        if (! host.idle.empty()) {
+          connection = std::move(host.idle.back());
+          host.idle.pop_back();
+        }
+        else {
+          connection = std::make_unique<Connection>(key,
+                                                    _ioc.get_executor());
+          connection->Options(_options.Request());
+        }
+        GetFailure                         failure;
+        http::response<http::string_body>  response;
+        _inFlight.insert(connection.get());
+        co_await connection->AsyncGet(url, response, failure, true);
+        _inFlight.erase(connection.get());
+        if (_expired && failure) {
+          failure.FailNum(GetFailure::k_failNumTimeout);
+        }
+        _callback(idx, failure, response);
+        if ((! _expired) && connection->Reusable()) {
+          host.idle.push_back(std::move(connection));
+        }
+        --host.active;
+        --_active;
+        Launch();
+        co_return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  Called when the deadline passes.  Cancels in-flight requests and
+      //!  fails the ones we haven't started.
+      //----------------------------------------------------------------------
+      void Expire()
+      {
+        _expired = true;
+        for (auto connection : _inFlight) {
+          connection->Cancel();
+        }
+        http::response<http::string_body>  response;
+        for (auto & host : _hosts) {
+          for (const auto & pending : host.second.pending) {
+            GetFailure  failure(GetFailure::k_failNumTimeout);
+            _callback(pending.first, failure, response);
+          }
+          host.second.pending.clear();
+          host.second.idle.clear();
+        }
+        _pending = 0;
+        return;
+      }
+    };
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static void RunBatch(const std::vector<Url> & urls,
+                         const std::vector<bool> & valid,
+                         const BatchOptions & options,
+                         BatchRunner::Callback callback)
+    {
+      BatchRunner  runner(options, callback);
+      for (size_t i = 0; i < urls.size(); ++i) {
+        if (valid[i]) {
+          runner.Add(i, urls[i]);
+        }
+      }
+      runner.Run();
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static void ParseUrls(const std::vector<std::string> & urlstrs,
+                          std::vector<Url> & urls, std::vector<bool> & valid)
+    {
+      urls.resize(urlstrs.size());
+      valid.resize(urlstrs.size());
+      for (size_t i = 0; i < urlstrs.size(); ++i) {
+        valid[i] = urls[i].Parse(urlstrs[i]);
+        if (! valid[i]) {
+          Syslog(LOG_ERR, "Failed to parse URL '%s'", urlstrs[i].c_str());
+        }
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static std::vector<std::pair<GetFailure,int>>
+    GetStatusMany(const std::vector<Url> & urls,
+                  const std::vector<bool> & valid,
+                  const BatchOptions & options)
+    {
+      std::vector<std::pair<GetFailure,int>>
+        rc(urls.size(), {GetFailure(GetFailure::k_failNumURL), -1});
+      RunBatch(urls, valid, options,
+               [&rc] (size_t idx, GetFailure & failure,
+                      http::response<http::string_body> & response)
+               {
+                 rc[idx].first = failure;
+                 rc[idx].second = failure ? -1 : response.result_int();
+               });
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,int>>
+    GetStatusMany(const std::vector<std::string> & urlstrs,
+                  const BatchOptions & options)
+    {
+      std::vector<Url>   urls;
+      std::vector<bool>  valid;
+      ParseUrls(urlstrs, urls, valid);
+      return GetStatusMany(urls, valid, options);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,int>>
+    GetStatusMany(const std::vector<Url> & urls, const BatchOptions & options)
+    {
+      return GetStatusMany(urls, std::vector<bool>(urls.size(), true),
+                           options);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static std::vector<std::pair<GetFailure,nlohmann::json>>
+    GetJsonMany(const std::vector<Url> & urls,
+                const std::vector<bool> & valid,
+                const BatchOptions & options)
+    {
+      std::vector<std::pair<GetFailure,nlohmann::json>>
+        rc(urls.size(), {GetFailure(GetFailure::k_failNumURL),
+                         nlohmann::json()});
+      RunBatch(urls, valid, options,
+               [&rc] (size_t idx, GetFailure & failure,
+                      http::response<http::string_body> & response)
+               {
+                 rc[idx].first = failure;
+                 if (! failure) {
+                   rc[idx].second =
+                     nlohmann::json::parse(response.body(), nullptr, false);
+                   if (rc[idx].second.is_discarded()) {
+                     rc[idx].first.FailNum(GetFailure::k_failNumJSON);
+                   }
+                 }
+               });
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,nlohmann::json>>
+    GetJsonMany(const std::vector<std::string> & urlstrs,
+                const BatchOptions & options)
+    {
+      std::vector<Url>   urls;
+      std::vector<bool>  valid;
+      ParseUrls(urlstrs, urls, valid);
+      return GetJsonMany(urls, valid, options);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::vector<std::pair<GetFailure,nlohmann::json>>
+    GetJsonMany(const std::vector<Url> & urls, const BatchOptions & options)
+    {
+      return GetJsonMany(urls, std::vector<bool>(urls.size(), true),
+                         options);
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
@@ -0,0 +1,1843 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsConnection.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ConnectionKey and Dwm::WebUtils::Connection
+//!  class implementations
+//---------------------------------------------------------------------------
+
+extern "C" {
+  #include <poll.h>
+}
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <filesystem>
+#include <limits>
+#include <streambuf>
+#include <tuple>
+#include <vector>
+
+#include <boost/certify/extensions.hpp>
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsConnection.hh"
+#include "DwmWebUtilsContentDecoder.hh"
+#include "DwmWebUtilsRequestContext.hh"
+#include "DwmWebUtilsResolverCache.hh"
+#include "DwmWebUtilsSSLContextCache.hh"
+#include "DwmWebUtilsTLSSessionCache.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace beast = boost::beast;
+    namespace asio = boost::asio;
+    namespace ssl = asio::ssl;
+    using tcp = boost::asio::ip::tcp;
+
+    //------------------------------------------------------------------------
+    //!  Sets the expiry of @c stream to @c expiry, where
+    //!  Clock::time_point::max() means never.
+    //------------------------------------------------------------------------
+    static void SetExpiry(beast::tcp_stream & stream,
+                          Connection::Clock::time_point expiry)
+    {
+      if (expiry == Connection::Clock::time_point::max()) {
+        stream.expires_never();
+      }
+      else {
+        stream.expires_at(expiry);
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns @c GetFailure::k_failNumTimeout if @c ec is a timeout,
+    //!  else returns @c failNum.
+    //------------------------------------------------------------------------
+    static uint16_t FailNum(const boost::system::error_code & ec,
+                            uint16_t failNum)
+    {
+      return ((ec == beast::error::timeout)
+              ? GetFailure::k_failNumTimeout : failNum);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Returns the failure number for a response read that failed with
+    //!  @c ec.
+    //------------------------------------------------------------------------
+    template <typename Parser>
+    static uint16_t ReadFailNum(const boost::system::error_code & ec,
+                                const Parser & parser)
+    {
+      uint16_t  rc = GetFailure::k_failNumGet;
+      if (ec == beast::error::timeout) {
+        rc = GetFailure::k_failNumTimeout;
+      }
+      else if (parser.is_header_done()
+               && (parser.get().result() != http::status::ok)) {
+        rc = parser.get().result_int();
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Returns the endpoints in @c results reordered for RFC 8305
+    //!  connection attempts: the family of the first (most preferred)
+    //!  endpoint first, then alternating between families, keeping the
+    //!  resolver's order within each family.
+    //------------------------------------------------------------------------
+    static std::vector<tcp::endpoint>
+    InterleaveFamilies(const tcp::resolver::results_type & results)
+    {
+      std::vector<tcp::endpoint>  rc, first, second;
+      if (! results.empty()) {
+        bool  firstIsV6 = results.begin()->endpoint().address().is_v6();
+        for (const auto & result : results) {
+          if (result.endpoint().address().is_v6() == firstIsV6) {
+            first.push_back(result.endpoint());
+          }
+          else {
+            second.push_back(result.endpoint());
+          }
+        }
+      }
+      for (size_t i = 0; i < std::max(first.size(), second.size()); ++i) {
+        if (i < first.size())   { rc.push_back(first[i]); }
+        if (i < second.size())  { rc.push_back(second[i]); }
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  State shared by AsyncConnectRace() and the completion handlers of
+    //!  its connection attempts, which may outlive it.
+    //------------------------------------------------------------------------
+    struct Connection::ConnectRace
+    {
+      ConnectRace(const asio::any_io_executor & executor)
+          : wakeup(executor), attempts(), winner(), pending(0),
+            done(false), lastError()
+      {}
+
+      //----------------------------------------------------------------------
+      //!  Wakes AsyncConnectRace().
+      //----------------------------------------------------------------------
+      void Wake()
+      {
+        wakeup.cancel();
+      }
+      
+      //----------------------------------------------------------------------
+      //!  Ends the race, closing any attempts still in progress.
+      //----------------------------------------------------------------------
+      void Finish()
+      {
+        done = true;
+        boost::system::error_code  ec;
+        for (auto & attempt : attempts) {
+          if (attempt) {
+            attempt->close(ec);
+          }
+        }
+        Wake();
+        return;
+      }
+      
+      asio::steady_timer                         wakeup;
+      std::vector<std::unique_ptr<tcp::socket>>  attempts;
+      std::unique_ptr<tcp::socket>               winner;
+      size_t                                     pending;
+      bool                                       done;
+      boost::system::error_code                  lastError;
+    };
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ConnectionKey::ConnectionKey(const Url & url, bool verifyCertificate)
+        : _scheme(url.Scheme()), _host(url.Host()), _port(url.Port()),
+          _verifyCertificate(verifyCertificate)
+    {}
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ConnectionKey & ConnectionKey::Assign(const Url & url,
+                                          bool verifyCertificate)
+    {
+      _scheme.assign(url.Scheme());
+      _host.assign(url.Host());
+      _port = url.Port();
+      _verifyCertificate = verifyCertificate;
+      return *this;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionKey::operator < (const ConnectionKey & key) const
+    {
+      return (std::tie(_scheme, _host, _port, _verifyCertificate)
+              < std::tie(key._scheme, key._host, key._port,
+                         key._verifyCertificate));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionKey::operator == (const ConnectionKey & key) const
+    {
+      return ((_scheme == key._scheme)
+              && (_host == key._host)
+              && (_port == key._port)
+              && (_verifyCertificate == key._verifyCertificate));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Connection::Connection(const ConnectionKey & key)
+        : _key(key), _options(), _deadline(Clock::time_point::max()),
+          _ioc(std::make_unique<asio::io_context>()),
+          _executor(_ioc->get_executor()), _resolver(_executor),
+          _race(), _sslContext(), _httpStream(), _httpsStream(), _keepAlive(false),
+          _cancelled(false), _requests(0), _lastUsed(Clock::now()),
+          _offerHttp2(false), _protocol(), _timer(_executor)
+    {}
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Connection::Connection(const ConnectionKey & key,
+                           const asio::any_io_executor & executor)
+        : _key(key), _options(), _deadline(Clock::time_point::max()),
+          _ioc(), _executor(executor), _resolver(_executor),
+          _race(), _sslContext(), _httpStream(), _httpsStream(), _keepAlive(false),
+          _cancelled(false), _requests(0), _lastUsed(Clock::now()),
+          _offerHttp2(false), _protocol(), _timer(_executor)
+    {}
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Connection::~Connection()
+    {
+      Close();
+    }
+
+    //------------------------------------------------------------------------
+    //!  Logs the exception @c ep that escaped from a coroutine, and returns
+    //!  @c GetFailure::k_failNumUnknown.
+    //------------------------------------------------------------------------
+    static uint16_t ExceptionFailNum(std::exception_ptr ep)
+    {
+      try {
+        std::rethrow_exception(ep);
+      }
+      catch (const std::exception & ex) {
+        Syslog(LOG_ERR, "Exception during request: %s", ex.what());
+      }
+      catch (...) {
+        Syslog(LOG_ERR, "Unknown exception during request");
+      }
+      return GetFailure::k_failNumUnknown;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename T>
+    T Connection::Run(asio::awaitable<T> && op, GetFailure & failure)
+    {
+      assert(_ioc);
+      T  rc{};
+      asio::co_spawn(*_ioc, std::move(op),
+                     [&] (std::exception_ptr ep, T result) {
+                       if (ep) {
+                         failure.FailNum(ExceptionFailNum(ep));
+                       }
+                       else {
+                         rc = std::move(result);
+                       }
+                     });
+      _ioc->restart();
+      _ioc->run();
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Marks the end of @c phase in @c metrics, if there are any.
+    //------------------------------------------------------------------------
+    static void Mark(RequestMetrics *metrics, RequestMetrics::PhaseEnum phase)
+    {
+      if (metrics) {
+        metrics->Mark(phase);
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Adds @c n bytes read to @c metrics (if any), marking the first
+    //!  byte if these are the first.
+    //------------------------------------------------------------------------
+    static void CountRead(RequestMetrics *metrics, size_t n)
+    {
+      if (metrics && n) {
+        if (! metrics->Reached(RequestMetrics::e_firstByte)) {
+          metrics->Mark(RequestMetrics::e_firstByte);
+        }
+        metrics->BytesRead(metrics->BytesRead() + n);
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void Connection::Run(asio::awaitable<void> && op)
+    {
+      assert(_ioc);
+      asio::co_spawn(*_ioc, std::move(op),
+                     [] (std::exception_ptr ep) {
+                       if (ep) {
+                         ExceptionFailNum(ep);
+                       }
+                     });
+      _ioc->restart();
+      _ioc->run();
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Open(GetFailure & failure)
+    {
+      return Run(AsyncOpen(failure), failure);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool> Connection::AsyncOpen(GetFailure & failure)
+    {
+      _deadline = Expiry(_options.TotalTimeout());
+      BeginMetrics();
+      bool  rc = co_await AsyncConnect(failure);
+      _deadline = Clock::time_point::max();
+      co_return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Connection::Clock::time_point
+    Connection::Expiry(std::chrono::milliseconds timeout) const
+    {
+      Clock::time_point  rc = _deadline;
+      if (timeout.count() > 0) {
+        rc = std::min(rc, Clock::now() + timeout);
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool> Connection::AsyncConnect(GetFailure & failure)
+    {
+      co_await AsyncClose();
+      _requests = 0;
+      _lastUsed = Clock::now();
+      bool  rc = false;
+      if (_cancelled) {
+        failure.FailNum(GetFailure::k_failNumConnect);
+      }
+      else if (_key.Scheme() == "https") {
+        rc = co_await AsyncOpenHttps(failure);
+      }
+      else if (_key.Scheme() == "http") {
+        rc = co_await AsyncOpenHttp(failure);
+      }
+      else {
+        failure.FailNum(GetFailure::k_failNumURL);
+        Syslog(LOG_ERR, "Unhandled URL scheme '%s'", _key.Scheme().c_str());
+      }
+      co_return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<tcp::resolver::results_type>
+    Connection::AsyncResolve(Clock::time_point expiry,
+                             boost::system::error_code & ec)
+    {
+      std::string                  service(std::to_string(_key.Port()));
+      tcp::resolver::results_type  results;
+      if (ResolverCache::Lookup(_key.Host(), service, results, ec)) {
+        if (_options.Metrics()) {
+          _options.Metrics()->DnsCached(true);
+        }
+        co_return results;
+      }
+      
+      //  The resolver has no expiry of its own, so cancel it from a timer.
+      //  'done' keeps a late timer handler from touching the resolver
+      //  after we've moved on.
+      asio::steady_timer  timer(_executor);
+      auto  done = std::make_shared<bool>(false);
+      if (expiry != Clock::time_point::max()) {
+        timer.expires_at(expiry);
+        timer.async_wait([this, done] (boost::system::error_code tec)
+                         { if ((! tec) && (! *done)) { _resolver.cancel(); } });
+      }
+      results =
+        co_await _resolver.async_resolve(_key.Host(), service,
+                                         asio::redirect_error(asio::use_awaitable, ec));
+      *done = true;
+      timer.cancel();
+      if ((ec == asio::error::operation_aborted) && (! _cancelled)
+          && (Clock::now() >= expiry)) {
+        ec = beast::error::timeout;
+      }
+      ResolverCache::Insert(_key.Host(), service, results, ec);
+      co_return results;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<std::unique_ptr<tcp::socket>>
+    Connection::AsyncConnectRace(const tcp::resolver::results_type & results,
+                                 Clock::time_point expiry,
+                                 boost::system::error_code & ec)
+    {
+      std::vector<tcp::endpoint>  endpoints = InterleaveFamilies(results);
+      std::chrono::milliseconds   delay = _options.ConnectAttemptDelay();
+      auto    race = std::make_shared<ConnectRace>(_executor);
+      size_t  next = 0;
+      _race = race;
+      ec.clear();
+      while (! race->done) {
+        if (_cancelled) {
+          ec = asio::error::operation_aborted;
+          break;
+        }
+        if (Clock::now() >= expiry) {
+          ec = beast::error::timeout;
+          break;
+        }
+        if (next < endpoints.size()) {
+          //  Start the next attempt.  We get here at the start, when the
+          //  attempt delay has passed, and when an attempt has failed.
+          size_t  idx = race->attempts.size();
+          race->attempts.push_back(std::make_unique<tcp::socket>(_executor));
+          ++race->pending;
+          race->attempts[idx]->async_connect
+            (endpoints[next++],
+             [race, idx] (boost::system::error_code aec)
+             {
+               --race->pending;
+               if (! race->done) {
+                 if (! aec) {
+                   race->winner = std::move(race->attempts[idx]);
+                   race->Finish();
+                 }
+                 else {
+                   race->lastError = aec;
+                   race->Wake();
+                 }
+               }
+             });
+        }
+        else if (! race->pending) {
+          ec = (race->lastError ? race->lastError
+                : asio::error::host_not_found);
+          break;
+        }
+        Clock::time_point  wake = expiry;
+        if ((next < endpoints.size()) && (delay.count() > 0)) {
+          wake = std::min(wake, Clock::now() + delay);
+        }
+        race->wakeup.expires_at(wake);
+        boost::system::error_code  wec;
+        co_await race->wakeup.async_wait(asio::redirect_error(asio::use_awaitable, wec));
+      }
+      _race.reset();
+      if (! race->winner) {
+        race->Finish();
+        if (! ec) {
+          ec = asio::error::operation_aborted;
+        }
+      }
+      co_return std::move(race->winner);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool> Connection::AsyncOpenHttp(GetFailure & failure)
+    {
+      Clock::time_point  expiry = Expiry(_options.ConnectTimeout());
+      boost::system::error_code  ec;
+      auto  endpoints = co_await AsyncResolve(expiry, ec);
+      Mark(_options.Metrics(), RequestMetrics::e_dnsDone);
+      if (! ec) {
+        auto  socket = co_await AsyncConnectRace(endpoints, expiry, ec);
+        if (! ec) {
+          Mark(_options.Metrics(), RequestMetrics::e_connectDone);
+          _httpStream =
+            std::make_unique<beast::tcp_stream>(std::move(*socket));
+        }
+      }
+      if (ec) {
+        _httpStream.reset();
+        failure.FailNum(FailNum(ec, GetFailure::k_failNumConnect));
+        co_return false;
+      }
+      co_return true;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool> Connection::AsyncOpenHttps(GetFailure & failure)
+    {
+      if (! _sslContext) {
+        _sslContext = SSLContextCache::Get(_key.VerifyCertificate());
+      }
+      
+      std::string  service(std::to_string(_key.Port()));
+      Clock::time_point  expiry = Expiry(_options.ConnectTimeout());
+      boost::system::error_code  ec;
+      auto  endpoints = co_await AsyncResolve(expiry, ec);
+      Mark(_options.Metrics(), RequestMetrics::e_dnsDone);
+      if (! ec) {
+        auto  socket = co_await AsyncConnectRace(endpoints, expiry, ec);
+        if (! ec) {
+          Mark(_options.Metrics(), RequestMetrics::e_connectDone);
+          _httpsStream =
+            std::make_unique<SslStream>(beast::tcp_stream(std::move(*socket)),
+                                        *_sslContext);
+        }
+      }
+      if (ec) {
+        Syslog(LOG_ERR, "Failed to connect to %s:%s", _key.Host().c_str(),
+               service.c_str());
+        _httpsStream.reset();
+        failure.FailNum(FailNum(ec, GetFailure::k_failNumConnect));
+        co_return false;
+      }
+      Syslog(LOG_INFO, "Connected to %s:%s", _key.Host().c_str(),
+             service.c_str());
+      
+      try {
+        boost::certify::set_server_hostname(*_httpsStream, _key.Host());
+        boost::certify::sni_hostname(*_httpsStream, _key.Host());
+      }
+      catch (...) {
+        ec = asio::error::invalid_argument;
+      }
+      if ((! ec) && _offerHttp2) {
+        //  Only an Http2Session asks for h2; everyone else speaks
+        //  HTTP/1.1 on the connection.
+        static const unsigned char  protos[] = "\x02h2\x08http/1.1";
+        if (SSL_set_alpn_protos(_httpsStream->native_handle(), protos,
+                                sizeof(protos) - 1) != 0) {
+          ec = asio::error::invalid_argument;
+        }
+      }
+      if (! ec) {
+        TLSSessionCache::Offer(_httpsStream->native_handle(), _key);
+        SetExpiry(beast::get_lowest_layer(*_httpsStream),
+                  Expiry(_options.HandshakeTimeout()));
+        co_await
+          _httpsStream->async_handshake(ssl::stream_base::handshake_type::client,
+                                        asio::redirect_error(asio::use_awaitable, ec));
+      }
+      TLSSessionCache::HandshakeDone(_httpsStream->native_handle(), ! ec);
+      if (ec) {
+        Syslog(LOG_ERR, "HTTPS handshake with %s failed",
+               _key.Host().c_str());
+        failure.FailNum(FailNum(ec, GetFailure::k_failNumAuth));
+        beast::get_lowest_layer(*_httpsStream).close();
+        _httpsStream.reset();
+        co_return false;
+      }
+      beast::get_lowest_layer(*_httpsStream).expires_never();
+      if (auto metrics = _options.Metrics()) {
+        metrics->Mark(RequestMetrics::e_tlsDone);
+        SSL  *ssl = _httpsStream->native_handle();
+        metrics->TlsSessionReused(SSL_session_reused(ssl));
+      }
+      const unsigned char  *proto = nullptr;
+      unsigned int          protoLen = 0;
+      SSL_get0_alpn_selected(_httpsStream->native_handle(), &proto,
+                             &protoLen);
+      _protocol.clear();
+      if (proto) {
+        _protocol.assign((const char *)proto, protoLen);
+      }
+      co_return true;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::IsOpen() const
+    {
+      if (_httpsStream) {
+        return beast::get_lowest_layer(*_httpsStream).socket().is_open();
+      }
+      if (_httpStream) {
+        return _httpStream->socket().is_open();
+      }
+      return false;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    tcp::endpoint Connection::RemoteEndpoint() const
+    {
+      boost::system::error_code  ec;
+      tcp::endpoint  rc;
+      if (_httpsStream) {
+        auto  & socket = beast::get_lowest_layer(*_httpsStream).socket();
+        rc = socket.remote_endpoint(ec);
+      }
+      else if (_httpStream) {
+        rc = _httpStream->socket().remote_endpoint(ec);
+      }
+      return (ec ? tcp::endpoint() : rc);
+    }
+
+    //------------------------------------------------------------------------
+    //!  Clears the metrics from Options() (if any) and marks the start of
+    //!  a request.
+    //------------------------------------------------------------------------
+    RequestMetrics *Connection::BeginMetrics()
+    {
+      auto  metrics = _options.Metrics();
+      if (metrics) {
+        metrics->Clear();
+        metrics->Mark(RequestMetrics::e_start);
+      }
+      return metrics;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int Connection::NativeHandle()
+    {
+      int  rc = -1;
+      if (_httpsStream) {
+        rc = beast::get_lowest_layer(*_httpsStream).socket().native_handle();
+      }
+      else if (_httpStream) {
+        rc = _httpStream->socket().native_handle();
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::IsStale()
+    {
+      bool  rc = true;
+      if (IsOpen()) {
+        struct pollfd  pfd = { NativeHandle(), POLLIN, 0 };
+        rc = (::poll(&pfd, 1, 0) != 0);
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void Connection::Close()
+    {
+      if (_ioc) {
+        Run(AsyncClose());
+      }
+      else {
+        boost::system::error_code  ec;
+        if (_httpsStream) {
+          beast::get_lowest_layer(*_httpsStream).socket().close(ec);
+          _httpsStream.reset();
+        }
+        if (_httpStream) {
+          _httpStream->socket().close(ec);
+          _httpStream.reset();
+        }
+        _keepAlive = false;
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<void> Connection::AsyncClose()
+    {
+      boost::system::error_code  ec;
+      if (_httpsStream) {
+        SetExpiry(beast::get_lowest_layer(*_httpsStream),
+                  Expiry(_options.HandshakeTimeout()));
+        co_await _httpsStream->async_shutdown(asio::redirect_error(asio::use_awaitable, ec));
+        beast::get_lowest_layer(*_httpsStream).socket().close(ec);
+        _httpsStream.reset();
+      }
+      if (_httpStream) {
+        _httpStream->socket().shutdown(tcp::socket::shutdown_both, ec);
+        _httpStream->socket().close(ec);
+        _httpStream.reset();
+      }
+      _keepAlive = false;
+      co_return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void Connection::Cancel()
+    {
+      _cancelled = true;
+      _resolver.cancel();
+      if (_race) {
+        _race->Finish();
+      }
+      if (_httpsStream) {
+        beast::get_lowest_layer(*_httpsStream).cancel();
+      }
+      if (_httpStream) {
+        _httpStream->cancel();
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Reusable() const
+    {
+      return (_keepAlive && IsOpen());
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Get(const Url & url,
+                         http::response<http::string_body> & response,
+                         GetFailure & failure, bool keepAlive)
+    {
+      return Run(AsyncGet(url, response, failure, keepAlive), failure);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool>
+    Connection::AsyncGet(const Url & url,
+                         http::response<http::string_body> & response,
+                         GetFailure & failure, bool keepAlive)
+    {
+      auto  cache = _options.Cache();
+      std::string  key;
+      std::shared_ptr<const ResponseCache::Entry>  cached;
+      if (cache) {
+        key = ResponseCache::Key(url.to_string());
+        cached = cache->Find(key);
+        if (cached && cached->Fresh()) {
+          BeginMetrics();
+          cache->CountHit();
+          response = cached->response;
+          failure.FailNum(GetFailure::k_failNumNone);
+          co_return true;
+        }
+      }
+      bool  rc = co_await
+        AsyncRequest(url, failure,
+                     [&] (auto & stream, bool & gotSome)
+                     { return AsyncSend(stream, url, response, cached.get(),
+                                        failure, keepAlive, gotSome); });
+      if (rc && cache) {
+        auto  entry = cache->Update(key, response);
+        if (entry && (response.result() == http::status::not_modified)) {
+          response = entry->response;
+        }
+      }
+      co_return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Get(const Url & url, PmrResponse & response,
+                         GetFailure & failure, bool keepAlive)
+    {
+      return Run(AsyncGet(url, response, failure, keepAlive), failure);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool>
+    Connection::AsyncGet(const Url & url, PmrResponse & response,
+                         GetFailure & failure, bool keepAlive)
+    {
+      co_return co_await
+        AsyncRequest(url, failure,
+                     [&] (auto & stream, bool & gotSome)
+                     { return AsyncSend(stream, url, response, nullptr,
+                                        failure, keepAlive, gotSome); });
+    }
+
+    //------------------------------------------------------------------------
+    //!  Wraps a completion handler so that asio and beast allocate the
+    //!  state of the operation from a RequestContext's arena.  It also
+    //!  carries the concrete io_context executor; without it, completions
+    //!  are dispatched through any_io_executor, which allocates.
+    //------------------------------------------------------------------------
+    template <typename F>
+    class ArenaHandler
+    {
+    public:
+      using allocator_type = RequestContext::Allocator<char>;
+      using executor_type = asio::io_context::executor_type;
+
+      ArenaHandler(const allocator_type & allocator,
+                   const executor_type & executor, F f)
+          : _allocator(allocator), _executor(executor), _f(std::move(f))
+      {}
+
+      allocator_type get_allocator() const noexcept
+      { return _allocator; }
+
+      executor_type get_executor() const noexcept
+      { return _executor; }
+
+      template <typename... Args>
+      void operator () (Args &&... args)
+      { _f(std::forward<Args>(args)...); }
+
+    private:
+      allocator_type  _allocator;
+      executor_type   _executor;
+      F               _f;
+    };
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Get(const Url & url, RequestContext & context,
+                         GetFailure & failure, bool keepAlive)
+    {
+      assert(_ioc);
+      auto  deadline = Expiry(_options.TotalTimeout());
+      bool  reused = (IsOpen() && (_requests > 0));
+      //  Open() begins the metrics itself.  If the connection was opened
+      //  for this request, keep what was recorded while connecting.
+      auto  metrics = (reused ? BeginMetrics() : _options.Metrics());
+      if ((! IsOpen()) && (! Open(failure))) {
+        return false;
+      }
+      if (metrics) {
+        metrics->ConnectionReused(reused);
+        metrics->RemoteEndpoint(RemoteEndpoint());
+      }
+      _deadline = deadline;
+      bool  gotSome = false;
+      bool  rc = _httpsStream
+        ? Exchange(*_httpsStream, url, context, failure, keepAlive, gotSome)
+        : Exchange(*_httpStream, url, context, failure, keepAlive, gotSome);
+      if (! rc) {
+        Close();
+        if (reused && (! gotSome)
+            && (failure.FailNum() != GetFailure::k_failNumTimeout)) {
+          //  The server probably closed the connection while it was idle.
+          //  Reconnect and try once more.
+          Syslog(LOG_DEBUG, "Retrying GET of %s on new connection",
+                 url.to_string().c_str());
+          if (Open(failure)) {
+            if (metrics) {
+              metrics->RemoteEndpoint(RemoteEndpoint());
+            }
+            _deadline = deadline;
+            rc = _httpsStream
+              ? Exchange(*_httpsStream, url, context, failure, keepAlive,
+                         gotSome)
+              : Exchange(*_httpStream, url, context, failure, keepAlive,
+                         gotSome);
+            if (! rc) {
+              Close();
+            }
+          }
+        }
+      }
+      _deadline = Clock::time_point::max();
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Starts an asynchronous operation with start(handler) and runs our
+    //!  io_context until it completes, cancelling it at @c expiry.  The
+    //!  operation and our timer allocate from @c context's arena.  The
+    //!  number of bytes transferred is stored in @c bytes.  Returns the
+    //!  error from the operation, or beast::error::timeout.
+    //------------------------------------------------------------------------
+    template <typename T, typename Start>
+    boost::system::error_code
+    Connection::RunWithTimeout(T & stream, RequestContext & context,
+                               Clock::time_point expiry, Start start,
+                               size_t & bytes)
+    {
+      bytes = 0;
+      boost::system::error_code  ec;
+      bool  done = false, expired = false;
+      if (expiry != Clock::time_point::max()) {
+        _timer.expires_at(expiry);
+        _timer.async_wait(ArenaHandler(context.GetAllocator(),
+                                       _ioc->get_executor(),
+                                       [&] (boost::system::error_code tec) {
+                                         if ((! tec) && (! done)) {
+                                           expired = true;
+                                           boost::system::error_code  cec;
+                                           beast::get_lowest_layer(stream)
+                                             .socket().cancel(cec);
+                                         }
+                                       }));
+      }
+      start(ArenaHandler(context.GetAllocator(), _ioc->get_executor(),
+                         [&] (boost::system::error_code oec, size_t n) {
+                           ec = oec;
+                           bytes = n;
+                           done = true;
+                           _timer.cancel();
+                         }));
+      _ioc->restart();
+      _ioc->run();
+      if (expired) {
+        ec = beast::error::timeout;
+      }
+      return ec;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  The RequestContext flavor of AsyncSend().  Not a coroutine, since
+    //!  coroutine frames can't be allocated from the context.
+    //------------------------------------------------------------------------
+    template <typename T>
+    bool Connection::Exchange(T & stream, const Url & url,
+                              RequestContext & context, GetFailure & failure,
+                              bool keepAlive, bool & gotSome)
+    {
+      gotSome = false;
+      if (_cancelled) {
+        failure.FailNum(GetFailure::k_failNumGet);
+        return false;
+      }
+      context.Prepare(url, keepAlive, _options.Compression());
+      context.StartResponse();
+      auto  & parser = *context._parser;
+      //  We time the operations ourselves, so tcp_stream doesn't need a
+      //  timer (whose handler we couldn't allocate from the context).
+      beast::get_lowest_layer(stream).expires_never();
+      size_t  n;
+      auto  ec = RunWithTimeout(stream, context,
+                                Expiry(_options.IdleReadTimeout()),
+                                [&] (auto && handler) {
+                                  http::async_write(stream, context._request,
+                                                    std::move(handler));
+                                }, n);
+      auto  metrics = _options.Metrics();
+      Mark(metrics, RequestMetrics::e_requestSent);
+      while ((! ec) && (! parser.is_done())) {
+        ec = RunWithTimeout(stream, context,
+                            Expiry(_options.IdleReadTimeout()),
+                            [&] (auto && handler) {
+                              http::async_read_some(stream, context._buffer,
+                                                    parser,
+                                                    std::move(handler));
+                            }, n);
+        CountRead(metrics, n);
+      }
+      gotSome = parser.got_some();
+      _lastUsed = Clock::now();
+      if (ec) {
+        failure.FailNum(ReadFailNum(ec, parser));
+        context.FinishResponse();
+        return false;
+      }
+      Mark(metrics, RequestMetrics::e_bodyDone);
+      context.FinishResponse();
+      _keepAlive = (keepAlive && context._response.keep_alive());
+      ++_requests;
+      if (! context.DecodeBody()) {
+        failure.FailNum(GetFailure::k_failNumGet);
+        return false;
+      }
+      failure.FailNum(GetFailure::k_failNumNone);
+      return true;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool
+    Connection::GetPipelined(const std::vector<Url> & urls,
+                             std::vector<http::response<http::string_body>>
+                             & responses, std::vector<GetFailure> & failures,
+                             bool keepAlive)
+    {
+      GetFailure  failure;
+      bool  rc = Run(AsyncGetPipelined(urls, responses, failures, keepAlive),
+                     failure);
+      if (failure) {
+        //  We can't tell which requests were answered before the
+        //  exception, so don't report any of them as successful.
+        failures.resize(urls.size());
+        for (auto & f : failures) {
+          if (! f) {
+            f = failure;
+          }
+        }
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool>
+    Connection::AsyncGetPipelined(const std::vector<Url> & urls,
+                                  std::vector<http::response
+                                              <http::string_body>>
+                                  & responses,
+                                  std::vector<GetFailure> & failures,
+                                  bool keepAlive)
+    {
+      responses.assign(urls.size(), http::response<http::string_body>());
+      failures.assign(urls.size(), GetFailure());
+      auto  cache = _options.Cache();
+      CacheEntries         cached(urls.size());
+      std::vector<size_t>  pending;
+      for (size_t i = 0; i < urls.size(); ++i) {
+        if (! (ConnectionKey(urls[i], _key.VerifyCertificate()) == _key)) {
+          failures[i].FailNum(GetFailure::k_failNumURL);
+          continue;
+        }
+        if (cache) {
+          cached[i] = cache->Find(ResponseCache::Key(urls[i].to_string()));
+          if (cached[i] && cached[i]->Fresh()) {
+            cache->CountHit();
+            responses[i] = cached[i]->response;
+            continue;
+          }
+        }
+        pending.push_back(i);
+      }
+      if (pending.empty()) {
+        co_return (std::find_if(failures.begin(), failures.end(),
+                                [] (const GetFailure & f) { return f; })
+                   == failures.end());
+      }
+      
+      _deadline = Expiry(_options.TotalTimeout());
+      auto      deadline = _deadline;
+      size_t    resolved = 0;
+      GetFailure  failure;
+      bool  reused = (IsOpen() && (_requests > 0));
+      if (IsOpen() || co_await AsyncConnect(failure)) {
+        auto  send = [&] (auto & stream, bool & gotSome) {
+          return AsyncSendPipelined(stream, urls, pending, cached,
+                                    responses, failures, keepAlive,
+                                    resolved, gotSome);
+        };
+        bool  gotSome = false;
+        co_await AsyncDispatch(send, failure, gotSome);
+        if ((resolved == 0) && reused && (! gotSome)
+            && co_await AsyncConnect(failure)) {
+          //  The server probably closed the connection while it was idle.
+          co_await AsyncDispatch(send, failure, gotSome);
+        }
+      }
+      else {
+        //  Couldn't connect; sending them one at a time won't help.
+        for ( ; resolved < pending.size(); ++resolved) {
+          failures[pending[resolved]] = failure;
+        }
+      }
+      //  The server closed the connection (or said it would) before
+      //  answering everything.  Fall back to one request at a time for
+      //  the rest, within what's left of the total timeout.
+      if (resolved < pending.size()) {
+        Syslog(LOG_DEBUG, "%s:%hu answered %zu of %zu pipelined requests",
+               _key.Host().c_str(), _key.Port(), resolved, pending.size());
+        //  Don't send anything more on this connection.  The server
+        //  said it would close it, or responses to requests we already
+        //  sent are still unread.  Close it now so the first AsyncGet()
+        //  below opens a fresh one instead of failing and retrying.
+        if (IsOpen()) {
+          co_await AsyncClose();
+        }
+      }
+      for ( ; resolved < pending.size(); ++resolved) {
+        size_t  i = pending[resolved];
+        if (Clock::now() >= deadline) {
+          failures[i].FailNum(GetFailure::k_failNumTimeout);
+          continue;
+        }
+        _deadline = deadline;
+        co_await AsyncGet(urls[i], responses[i], failures[i], keepAlive);
+      }
+      _deadline = Clock::time_point::max();
+      co_return (std::find_if(failures.begin(), failures.end(),
+                              [] (const GetFailure & f) { return f; })
+                 == failures.end());
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Get(const Url & url, http::response_header<> & header,
+                         const BodyCallback & onBody, GetFailure & failure,
+                         bool keepAlive)
+    {
+      return Run(AsyncGet(url, header, onBody, failure, keepAlive), failure);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool>
+    Connection::AsyncGet(const Url & url, http::response_header<> & header,
+                         const BodyCallback & onBody, GetFailure & failure,
+                         bool keepAlive)
+    {
+      co_return co_await
+        AsyncRequest(url, failure,
+                     [&] (auto & stream, bool & gotSome)
+                     { return AsyncSend(stream, url, header, onBody,
+                                        failure, keepAlive, gotSome); });
+    }
+    
+    //------------------------------------------------------------------------
+    //!  A streambuf that delivers a response body as it arrives.  Each
+    //!  underflow() runs the io_context until the next chunk of the body
+    //!  has been received, so at most one chunk is held at a time.
+    //------------------------------------------------------------------------
+    class BodyStreamBuf
+      : public std::streambuf
+    {
+    public:
+      BodyStreamBuf(asio::io_context & ioc)
+          : _ioc(ioc), _pending(), _current(), _done(false),
+            _abandoned(false), _draining(false)
+      {}
+
+      //----------------------------------------------------------------------
+      //!  Returns a callback for the streaming Connection::AsyncGet().
+      //----------------------------------------------------------------------
+      BodyCallback Sink()
+      {
+        return [this] (std::string_view chunk)
+        {
+          if (_abandoned) {
+            return false;
+          }
+          if (! _draining) {
+            _pending.append(chunk);
+          }
+          return true;
+        };
+      }
+
+      //----------------------------------------------------------------------
+      //!  Called when the request is finished; no more data will arrive.
+      //----------------------------------------------------------------------
+      void Finish()
+      { _done = true; }
+
+      //----------------------------------------------------------------------
+      //!  Returns true if the request is finished.
+      //----------------------------------------------------------------------
+      bool Done() const
+      { return _done; }
+      
+      //----------------------------------------------------------------------
+      //!  Causes the request to be abandoned at the next chunk.
+      //----------------------------------------------------------------------
+      void Abandon()
+      { _abandoned = true; }
+
+      //----------------------------------------------------------------------
+      //!  Discards what's pending and any chunks that arrive later, so the
+      //!  rest of the body can be read without holding it.
+      //----------------------------------------------------------------------
+      void Drain()
+      {
+        _draining = true;
+        _pending.clear();
+      }
+
+    protected:
+      int_type underflow() override
+      {
+        while (_pending.empty() && (! _done)) {
+          if (! _ioc.run_one()) {
+            break;
+          }
+        }
+        if (_pending.empty()) {
+          return traits_type::eof();
+        }
+        _current.swap(_pending);
+        _pending.clear();
+        setg(_current.data(), _current.data(),
+             _current.data() + _current.size());
+        return traits_type::to_int_type(*gptr());
+      }
+
+    private:
+      asio::io_context  & _ioc;
+      std::string         _pending;
+      std::string         _current;
+      bool                _done;
+      bool                _abandoned;
+      bool                _draining;
+    };
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::Get(const Url & url, http::response_header<> & header,
+                         const BodyReader & reader, GetFailure & failure,
+                         bool keepAlive)
+    {
+      assert(_ioc);
+      BodyStreamBuf  sbuf(*_ioc);
+      GetFailure     requestFailure;
+      bool  rc = false;
+      asio::co_spawn(*_ioc,
+                     AsyncGet(url, header, sbuf.Sink(), requestFailure,
+                              keepAlive),
+                     [&] (std::exception_ptr ep, bool result) {
+                       if (ep) {
+                         requestFailure.FailNum(ExceptionFailNum(ep));
+                       }
+                       rc = ((! ep) && result);
+                       sbuf.Finish();
+                     });
+      _ioc->restart();
+      failure.FailNum(GetFailure::k_failNumNone);
+      std::istream  is(&sbuf);
+      bool  accepted = reader(is);
+      bool  requestFailed = (sbuf.Done() && (! rc));
+      if (accepted) {
+        sbuf.Drain();
+      }
+      else {
+        sbuf.Abandon();
+      }
+      //  Finish the request: discard whatever the reader didn't want, or
+      //  let the abandoned request fail.
+      _ioc->run();
+      if (accepted || requestFailed) {
+        //  If the request failed before the reader gave up, that's why
+        //  the reader gave up.
+        failure = requestFailure;
+        rc = (rc && accepted);
+      }
+      else {
+        //  The reader rejected the body.  Leave any failure it set.
+        if (! failure) {
+          failure.FailNum(GetFailure::k_failNumGet);
+        }
+        rc = false;
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Connection::GetToFile(const Url & url, const std::string & path,
+                               bool resume, TransferStats & stats,
+                               GetFailure & failure, bool keepAlive)
+    {
+      return Run(AsyncGetToFile(url, path, resume, stats, failure,
+                                keepAlive), failure);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::awaitable<bool>
+    Connection::AsyncGetToFile(const Url & url, const std::string & path,
+                               bool resume, TransferStats & stats,
+                               GetFailure & failure, bool keepAlive)
+    {
+      co_return co_await
+        AsyncRequest(url, failure,
+                     [&] (auto & stream, bool & gotSome)
+                     { return AsyncSend(stream, url, path, resume, stats,
+                                        failure, keepAlive, gotSome); });
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename F>
+    asio::awaitable<bool>
+    Connection::AsyncRequest(const Url & url, GetFailure & failure, F send)
+    {
+      _deadline = Expiry(_options.TotalTimeout());
+      bool  gotSome = false;
+      bool  reused = (IsOpen() && (_requests > 0));
+      //  If the connection was opened for this request (AsyncOpen()),
+      //  keep what was recorded while connecting.
+      auto  metrics = ((IsOpen() && (! reused))
+                       ? _options.Metrics() : BeginMetrics());
+      if (metrics) {
+        metrics->ConnectionReused(reused);
+      }
+      if ((! IsOpen()) && (! co_await AsyncConnect(failure))) {
+        _deadline = Clock::time_point::max();
+        co_return false;
+      }
+      if (metrics) {
+        metrics->RemoteEndpoint(RemoteEndpoint());
+      }
+      bool  rc = co_await AsyncDispatch(send, failure, gotSome);
+      if ((! rc) && reused && (! gotSome)
+          && (failure.FailNum() != GetFailure::k_failNumTimeout)) {
+        //  The server probably closed the connection while it was idle.
+        //  Reconnect and try once more.
+        Syslog(LOG_DEBUG, "Retrying GET of %s on new connection",
+               url.to_string().c_str());
+        if (metrics) {
+          metrics->ConnectionReused(false);
+        }
+        if (co_await AsyncConnect(failure)) {
+          if (metrics) {
+            metrics->RemoteEndpoint(RemoteEndpoint());
+          }
+          rc = co_await AsyncDispatch(send, failure, gotSome);
+        }
+      }
+      _deadline = Clock::time_point::max();
+      co_return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename F>
+    asio::awaitable<bool>
+    Connection::AsyncDispatch(F & send, GetFailure & failure, bool & gotSome)
+    {
+      bool  rc = false;
+      if (_cancelled) {
+        failure.FailNum(GetFailure::k_failNumGet);
+      }
+      else if (_httpsStream) {
+        rc = co_await send(*_httpsStream, gotSome);
+      }
+      else if (_httpStream) {
+        rc = co_await send(*_httpStream, gotSome);
+      }
+      else {
+        failure.FailNum(GetFailure::k_failNumConnect);
+      }
+      if (! rc) {
+        co_await AsyncClose();
+      }
+      co_return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static http::request<http::string_body>
+    MakeRequest(const Url & url, bool keepAlive, bool compression)
+    {
+      http::request<http::string_body> request;
+      request.method(http::verb::get);
+      request.target(url.AfterAuthority());
+      request.keep_alive(keepAlive);
+      request.set(http::field::host, url.Host());
+      request.set(http::field::user_agent, "mcrover/1.0");
+      if (compression) {
+        request.set(http::field::accept_encoding,
+                    ContentDecoder::AcceptEncoding());
+      }
+      return request;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Adds the validators from @c cached (if any) to @c request, so the
+    //!  server can reply 304 if our cached copy is still good.
+    //------------------------------------------------------------------------
+    static void SetValidators(http::request<http::string_body> & request,
+                              const ResponseCache::Entry * cached)
+    {
+      if (cached) {
+        if (! cached->etag.empty()) {
+          request.set(http::field::if_none_match, cached->etag);
+        }
+        if (! cached->lastModified.empty()) {
+          request.set(http::field::if_modified_since, cached->lastModified);
+        }
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  If @c response has a Content-Encoding we can decode, replaces the
+    //!  body with the decoded body and removes the Content-Encoding.
+    //!  Returns false if the body could not be decoded.
+    //------------------------------------------------------------------------
+    template <typename Body, typename Fields>
+    static bool DecodeBody(http::response<Body,Fields> & response)
+    {
+      auto  it = response.find(http::field::content_encoding);
+      if (it == response.end()) {
+        return true;
+      }
+      ContentDecoder  decoder;
+      if (! decoder.Begin(it->value())) {
+        return true;  // identity, or something we leave to the caller
+      }
+      //  Allocated the same way as the body it replaces.
+      typename Body::value_type  decoded(response.body().get_allocator());
+      auto  append = [&] (std::string_view s) {
+        decoded.append(s);
+        return true;
+      };
+      if (! (decoder.Decode(response.body(), append) && decoder.End())) {
+        return false;
+      }
+      response.body() = std::move(decoded);
+      response.erase(http::field::content_encoding);
+      response.prepare_payload();
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename T, typename Body, typename Fields>
+    asio::awaitable<bool>
+    Connection::AsyncSend(T & stream, const Url & url,
+                          http::response<Body,Fields> & response,
+                          const ResponseCache::Entry * cached,
+                          GetFailure & failure, bool keepAlive,
+                          bool & gotSome)
+    {
+      auto  request = MakeRequest(url, keepAlive, _options.Compression());
+      SetValidators(request, cached);
+      gotSome = false;
+      //  The parser's message allocates the same way as response, so
+      //  release() below doesn't copy.
+      http::response_parser<Body,typename Fields::allocator_type>
+        parser(std::piecewise_construct,
+               std::make_tuple(response.body().get_allocator()),
+               std::make_tuple(response.get_allocator()));
+      beast::flat_buffer  buffer;
+      boost::system::error_code  ec;
+      auto  & lowest = beast::get_lowest_layer(stream);
+      SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+      co_await http::async_write(stream, request,
+                                 asio::redirect_error(asio::use_awaitable, ec));
+      auto  metrics = _options.Metrics();
+      Mark(metrics, RequestMetrics::e_requestSent);
+      //  Read piecewise so the idle timeout restarts whenever the server
+      //  sends us something.
+      while ((! ec) && (! parser.is_done())) {
+        SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+        size_t  n =
+          co_await http::async_read_some(stream, buffer, parser,
+                                         asio::redirect_error(asio::use_awaitable, ec));
+        CountRead(metrics, n);
+      }
+      lowest.expires_never();
+      gotSome = parser.got_some();
+      _lastUsed = Clock::now();
+      if (ec) {
+        failure.FailNum(ReadFailNum(ec, parser));
+        co_return false;
+      }
+      Mark(metrics, RequestMetrics::e_bodyDone);
+      response = parser.release();
+      _keepAlive = (keepAlive && response.keep_alive());
+      ++_requests;
+      if (! DecodeBody(response)) {
+        failure.FailNum(GetFailure::k_failNumGet);
+        co_return false;
+      }
+      failure.FailNum(GetFailure::k_failNumNone);
+      co_return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Writes the requests for @c urls[pending[...]] and reads the
+    //!  responses in order, keeping at most k_maxPipelineDepth requests
+    //!  outstanding so neither side can stall the other with full socket
+    //!  buffers.  @c resolved is set to the number of entries of
+    //!  @c pending whose result is final; the rest were not answered.
+    //!  @c gotSome is set to true if any response bytes arrived.  Returns
+    //!  true if all were answered and the connection is still usable.
+    //------------------------------------------------------------------------
+    template <typename T>
+    asio::awaitable<bool>
+    Connection::AsyncSendPipelined(T & stream, const std::vector<Url> & urls,
+                                   const std::vector<size_t> & pending,
+                                   const CacheEntries & cached,
+                                   std::vector<http::response
+                                               <http::string_body>>
+                                   & responses,
+                                   std::vector<GetFailure> & failures,
+                                   bool keepAlive, size_t & resolved,
+                                   bool & gotSome)
+    {
+      auto  cache = _options.Cache();
+      beast::flat_buffer  buffer;  // may hold the start of the next response
+      boost::system::error_code  ec;
+      auto    & lowest = beast::get_lowest_layer(stream);
+      size_t  sent = 0;
+      bool    serverKeepAlive = true;
+      resolved = 0;
+      gotSome = false;
+      while ((resolved < pending.size()) && serverKeepAlive) {
+        while ((! ec) && (sent < pending.size())
+               && ((sent - resolved) < k_maxPipelineDepth)) {
+          size_t  i = pending[sent];
+          bool    last = ((sent + 1) == pending.size());
+          auto  request = MakeRequest(urls[i], (last ? keepAlive : true),
+                                      _options.Compression());
+          SetValidators(request, cached[i].get());
+          SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+          co_await http::async_write(stream, request,
+                                     asio::redirect_error(asio::use_awaitable,
+                                                          ec));
+          if (ec) {
+            break;
+          }
+          ++sent;
+        }
+        if (sent == resolved) {
+          break;  // couldn't write anything
+        }
+        //  Even if a write failed, responses to what we sent may be
+        //  waiting for us.
+        size_t  i = pending[resolved];
+        http::response_parser<http::string_body>  parser;
+        boost::system::error_code  rec;
+        while ((! rec) && (! parser.is_done())) {
+          SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+          co_await http::async_read_some(stream, buffer, parser,
+                                         asio::redirect_error(asio::use_awaitable,
+                                                              rec));
+        }
+        lowest.expires_never();
+        gotSome = (gotSome || parser.got_some());
+        _lastUsed = Clock::now();
+        if (rec) {
+          if (rec == beast::error::timeout) {
+            //  Don't make the caller wait through that again.
+            for ( ; resolved < pending.size(); ++resolved) {
+              size_t  j = pending[resolved];
+              failures[j].FailNum(GetFailure::k_failNumTimeout);
+            }
+          }
+          else if (parser.got_some()) {
+            failures[i].FailNum(ReadFailNum(rec, parser));
+            ++resolved;
+          }
+          co_return false;
+        }
+        responses[i] = parser.release();
+        ++_requests;
+        ++resolved;
+        serverKeepAlive = responses[i].keep_alive();
+        if (! DecodeBody(responses[i])) {
+          failures[i].FailNum(GetFailure::k_failNumGet);
+          continue;
+        }
+        failures[i].FailNum(GetFailure::k_failNumNone);
+        if (cache) {
+          auto  entry = cache->Update(ResponseCache::Key(urls[i].to_string()),
+                                      responses[i]);
+          if (entry
+              && (responses[i].result() == http::status::not_modified)) {
+            responses[i] = entry->response;
+          }
+        }
+      }
+      _keepAlive = (keepAlive && serverKeepAlive);
+      co_return ((resolved == pending.size()) && (! ec));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename T>
+    asio::awaitable<bool>
+    Connection::AsyncSend(T & stream, const Url & url,
+                          http::response_header<> & header,
+                          const BodyCallback & onBody, GetFailure & failure,
+                          bool keepAlive, bool & gotSome)
+    {
+      auto  request = MakeRequest(url, keepAlive, _options.Compression());
+      gotSome = false;
+      http::response_parser<http::buffer_body>  parser;
+      //  Not boost::none; that's mishandled by some boost versions.
+      parser.body_limit(std::numeric_limits<std::uint64_t>::max());
+      std::unique_ptr<char[]>  chunk(new char[k_bodyChunkSize]);
+      bool  headerDone = false;
+      bool  aborted = false;
+      ContentDecoder  decoder;
+      bool  decoding = false;
+      beast::flat_buffer  buffer;
+      boost::system::error_code  ec;
+      auto  & lowest = beast::get_lowest_layer(stream);
+      SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+      co_await http::async_write(stream, request,
+                                 asio::redirect_error(asio::use_awaitable, ec));
+      auto  metrics = _options.Metrics();
+      Mark(metrics, RequestMetrics::e_requestSent);
+      while ((! ec) && (! parser.is_done())) {
+        parser.get().body().data = chunk.get();
+        parser.get().body().size = k_bodyChunkSize;
+        SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+        size_t  n =
+          co_await http::async_read_some(stream, buffer, parser,
+                                         asio::redirect_error(asio::use_awaitable, ec));
+        CountRead(metrics, n);
+        if (ec == http::error::need_buffer) {
+          ec = {};  // chunk is full
+        }
+        if (ec) {
+          break;
+        }
+        if ((! headerDone) && parser.is_header_done()) {
+          header = parser.get().base();
+          headerDone = true;
+          auto  ce = header.find(http::field::content_encoding);
+          if ((ce != header.end()) && decoder.Begin(ce->value())) {
+            //  The caller sees the decoded body, so describe it.
+            decoding = true;
+            header.erase(http::field::content_encoding);
+            header.erase(http::field::content_length);
+          }
+        }
+        size_t  len = k_bodyChunkSize - parser.get().body().size;
+        if (len) {
+          std::string_view  data(chunk.get(), len);
+          if (! (decoding ? decoder.Decode(data, onBody) : onBody(data))) {
+            aborted = true;
+            break;
+          }
+        }
+      }
+      if ((! ec) && (! aborted) && decoding && (! decoder.End())) {
+        aborted = true;
+      }
+      lowest.expires_never();
+      gotSome = parser.got_some();
+      _lastUsed = Clock::now();
+      if (aborted) {
+        failure.FailNum(GetFailure::k_failNumGet);
+        co_return false;
+      }
+      if (ec) {
+        failure.FailNum(ReadFailNum(ec, parser));
+        co_return false;
+      }
+      Mark(metrics, RequestMetrics::e_bodyDone);
+      _keepAlive = (keepAlive && parser.keep_alive());
+      ++_requests;
+      failure.FailNum(GetFailure::k_failNumNone);
+      co_return true;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Returns true if @c contentRange (from a 206 response) is of the
+    //!  form "bytes <offset>-<last>/<total>".
+    //------------------------------------------------------------------------
+    static bool RangeStartsAt(std::string_view contentRange, uint64_t offset)
+    {
+      std::string  prefix = "bytes " + std::to_string(offset) + "-";
+      return (contentRange.substr(0, prefix.size()) == prefix);
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns true if @c contentRange (from a 416 response) says the
+    //!  total size is @c size, i.e. we already have all of it.
+    //------------------------------------------------------------------------
+    static bool RangeIsComplete(std::string_view contentRange, uint64_t size)
+    {
+      return (contentRange == ("bytes */" + std::to_string(size)));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename T>
+    asio::awaitable<bool>
+    Connection::AsyncSend(T & stream, const Url & url,
+                          const std::string & path, bool resume,
+                          TransferStats & stats, GetFailure & failure,
+                          bool keepAlive, bool & gotSome)
+    {
+      //  No Accept-Encoding: the file should hold exactly what the server
+      //  has, and ranges of an encoded representation don't combine
+      //  with ranges of the file.
+      auto  request = MakeRequest(url, keepAlive, false);
+      gotSome = false;
+      stats = TransferStats();
+      uint64_t  offset = 0;
+      if (resume) {
+        std::error_code  sizeec;
+        offset = std::filesystem::file_size(path, sizeec);
+        if (sizeec) {
+          offset = 0;
+        }
+      }
+      if (offset) {
+        request.set(http::field::range,
+                    "bytes=" + std::to_string(offset) + "-");
+      }
+      auto  start = Clock::now();
+      //  Read the header first, so we know whether to append to or
+      //  rewrite the file before any of the body arrives.
+      http::response_parser<http::empty_body>  headerParser;
+      //  Not boost::none; that's mishandled by some boost versions.
+      headerParser.body_limit(std::numeric_limits<std::uint64_t>::max());
+      beast::flat_buffer  buffer;
+      boost::system::error_code  ec;
+      auto  & lowest = beast::get_lowest_layer(stream);
+      SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+      co_await http::async_write(stream, request,
+                                 asio::redirect_error(asio::use_awaitable, ec));
+      if (! ec) {
+        SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+        co_await http::async_read_header(stream, buffer, headerParser,
+                                         asio::redirect_error(asio::use_awaitable, ec));
+      }
+      gotSome = headerParser.got_some();
+      _lastUsed = Clock::now();
+      if (ec) {
+        lowest.expires_never();
+        failure.FailNum(ReadFailNum(ec, headerParser));
+        co_return false;
+      }
+      auto  status = headerParser.get().result();
+      auto  contentRange = headerParser.get()[http::field::content_range];
+      auto  mode = beast::file_mode::write;
+      if (offset && (status == http::status::partial_content)
+          && RangeStartsAt(contentRange, offset)) {
+        //  Not file_mode::append, which truncates in some boost versions.
+        mode = beast::file_mode::append_existing;
+        stats.ResumedAt(offset);
+      }
+      else if (offset && (status == http::status::range_not_satisfiable)
+               && RangeIsComplete(contentRange, offset)) {
+        //  We already have the whole thing.  Don't bother reading the
+        //  (error) body; just don't reuse the connection.
+        lowest.expires_never();
+        stats.ResumedAt(offset);
+        stats.Elapsed(std::chrono::duration_cast<std::chrono::microseconds>
+                      (_lastUsed - start));
+        _keepAlive = false;
+        ++_requests;
+        failure.FailNum(GetFailure::k_failNumNone);
+        co_return true;
+      }
+      else if (status != http::status::ok) {
+        lowest.expires_never();
+        failure.FailNum(headerParser.get().result_int());
+        co_return false;
+      }
+      
+      http::response_parser<http::file_body>  parser(std::move(headerParser));
+      beast::error_code  fileec;
+      parser.get().body().open(path.c_str(), mode, fileec);
+      if ((! fileec) && stats.ResumedAt()) {
+        parser.get().body().file().seek(offset, fileec);
+      }
+      if (fileec) {
+        lowest.expires_never();
+        Syslog(LOG_ERR, "Failed to open '%s': %s", path.c_str(),
+               fileec.message().c_str());
+        failure.FailNum(GetFailure::k_failNumUnknown);
+        co_return false;
+      }
+      while ((! ec) && (! parser.is_done())) {
+        SetExpiry(lowest, Expiry(_options.IdleReadTimeout()));
+        co_await http::async_read_some(stream, buffer, parser,
+                                       asio::redirect_error(asio::use_awaitable, ec));
+      }
+      lowest.expires_never();
+      _lastUsed = Clock::now();
+      uint64_t  size = parser.get().body().file().size(fileec);
+      stats.Bytes(size - stats.ResumedAt());
+      stats.Elapsed(std::chrono::duration_cast<std::chrono::microseconds>
+                    (_lastUsed - start));
+      if (ec) {
+        failure.FailNum((ec == beast::error::timeout)
+                        ? GetFailure::k_failNumTimeout
+                        : GetFailure::k_failNumGet);
+        co_return false;
+      }
+      _keepAlive = (keepAlive && parser.keep_alive());
+      ++_requests;
+      failure.FailNum(GetFailure::k_failNumNone);
+      co_return true;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
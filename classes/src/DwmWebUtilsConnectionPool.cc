@@ -0,0 +1,410 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsConnectionPool.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ConnectionPool class implementation
+//---------------------------------------------------------------------------
+
+#include <vector>
+
+#include "DwmWebUtilsConnectionPool.hh"
+#include "DwmWebUtilsRequestContext.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ConnectionPool::ConnectionPool(size_t maxPerHost,
+                                   std::chrono::milliseconds idleTimeout)
+        : _mtx(), _cv(), _maxPerHost(maxPerHost ? maxPerHost : 1),
+          _idleTimeout(idleTimeout), _idle(), _inUse(), _http2(),
+          _http1Only()
+    {}
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ConnectionPool::~ConnectionPool()
+    {
+      Clear();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ConnectionPool::MaxPerHost() const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _maxPerHost;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ConnectionPool::MaxPerHost(size_t maxPerHost)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      _maxPerHost = maxPerHost ? maxPerHost : 1;
+      _cv.notify_all();
+      return _maxPerHost;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::chrono::milliseconds ConnectionPool::IdleTimeout() const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _idleTimeout;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::chrono::milliseconds
+    ConnectionPool::IdleTimeout(std::chrono::milliseconds idleTimeout)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _idleTimeout = idleTimeout;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionPool::Get(const Url & url,
+                             http::response<http::string_body> & response,
+                             GetFailure & failure, bool verifyCertificate)
+    {
+      return Get(url, response, failure, RequestOptions(), verifyCertificate);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionPool::Get(const Url & url,
+                             http::response<http::string_body> & response,
+                             GetFailure & failure,
+                             const RequestOptions & options,
+                             bool verifyCertificate)
+    {
+      ConnectionKey  key(url, verifyCertificate);
+      bool  useHttp1 = true;
+      auto  session = Http2SessionFor(key, options, failure, useHttp1);
+      if (session) {
+        return session->Get(url, response, failure, options);
+      }
+      else if (! useHttp1) {
+        return false;
+      }
+      std::unique_ptr<Connection>  connection = Checkout(key);
+      connection->Options(options);
+      bool  rc = connection->Get(url, response, failure, true);
+      Return(std::move(connection));
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionPool::Get(const Url & url, PmrResponse & response,
+                             GetFailure & failure,
+                             const RequestOptions & options,
+                             bool verifyCertificate)
+    {
+      std::unique_ptr<Connection>  connection =
+        Checkout(ConnectionKey(url, verifyCertificate));
+      connection->Options(options);
+      bool  rc = connection->Get(url, response, failure, true);
+      Return(std::move(connection));
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionPool::Get(const Url & url,
+                             http::response_header<> & header,
+                             const BodyReader & reader, GetFailure & failure,
+                             const RequestOptions & options,
+                             bool verifyCertificate)
+    {
+      ConnectionKey  key(url, verifyCertificate);
+      bool  useHttp1 = true;
+      auto  session = Http2SessionFor(key, options, failure, useHttp1);
+      if (session) {
+        return session->Get(url, header, reader, failure, options);
+      }
+      else if (! useHttp1) {
+        return false;
+      }
+      std::unique_ptr<Connection>  connection = Checkout(key);
+      connection->Options(options);
+      bool  rc = connection->Get(url, header, reader, failure, true);
+      Return(std::move(connection));
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ConnectionPool::Get(const Url & url, RequestContext & context,
+                             GetFailure & failure,
+                             const RequestOptions & options,
+                             bool verifyCertificate)
+    {
+      std::unique_ptr<Connection>  connection =
+        Checkout(context.Key(url, verifyCertificate));
+      connection->Options(options);
+      bool  rc = connection->Get(url, context, failure, true);
+      Return(std::move(connection));
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Returns the (open) HTTP/2 session to use for @c key, creating it if
+    //!  needed.  Returns nullptr with @c useHttp1 set to true if HTTP/2
+    //!  wasn't requested or the server won't speak it, and nullptr with
+    //!  @c useHttp1 set to false if we couldn't connect.
+    //------------------------------------------------------------------------
+    std::shared_ptr<Http2Session>
+    ConnectionPool::Http2SessionFor(const ConnectionKey & key,
+                                    const RequestOptions & options,
+                                    GetFailure & failure, bool & useHttp1)
+    {
+      useHttp1 = true;
+      if ((! options.Http2()) || (key.Scheme() != "https")
+          || (! Http2Session::Supported())) {
+        return nullptr;
+      }
+      std::shared_ptr<Http2Session>  session, discard;
+      {
+        std::lock_guard<std::mutex>  lck(_mtx);
+        if (_http1Only.find(key) != _http1Only.end()) {
+          return nullptr;
+        }
+        auto  it = _http2.find(key);
+        if ((it != _http2.end()) && (! it->second->Usable())) {
+          discard = std::move(it->second);
+          _http2.erase(it);
+          it = _http2.end();
+        }
+        if (it == _http2.end()) {
+          it = _http2.emplace(key, std::make_shared<Http2Session>(key)).first;
+        }
+        session = it->second;
+      }
+      //  Only the first caller connects, the rest wait for it.
+      if (session->Open(options, failure)) {
+        return session;
+      }
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _http2.find(key);
+      if ((it != _http2.end()) && (it->second == session)) {
+        _http2.erase(it);
+      }
+      if (session->Refused()) {
+        _http1Only.insert(key);
+        failure.FailNum(GetFailure::k_failNumNone);
+      }
+      else {
+        useHttp1 = false;
+      }
+      return nullptr;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::unique_ptr<Connection>
+    ConnectionPool::Checkout(const ConnectionKey & key)
+    {
+      std::unique_ptr<Connection>  rc;
+      Discards                     discard;
+      std::unique_lock<std::mutex>  lck(_mtx);
+      for (;;) {
+        auto  iit = _idle.find(key);
+        if (iit != _idle.end()) {
+          Prune(iit->second, discard);
+          //  Most recently used connections are at the back.
+          while ((! rc) && (! iit->second.empty())) {
+            std::unique_ptr<Connection>  conn =
+              std::move(iit->second.back());
+            iit->second.pop_back();
+            if (conn->IsStale()) {
+              discard.push_back(std::move(conn));
+            }
+            else {
+              rc = std::move(conn);
+            }
+          }
+        }
+        if (rc) {
+          break;
+        }
+        size_t  & inUse = _inUse[key];
+        size_t  numIdle = (iit != _idle.end()) ? iit->second.size() : 0;
+        if ((inUse + numIdle) < _maxPerHost) {
+          rc = std::make_unique<Connection>(key);
+          break;
+        }
+        _cv.wait(lck);
+      }
+      ++_inUse[key];
+      lck.unlock();
+      //  discarded connections are closed here, outside the lock
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ConnectionPool::Return(std::unique_ptr<Connection> connection)
+    {
+      if (! connection) {
+        return;
+      }
+      std::unique_ptr<Connection>  discard;
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  uit = _inUse.find(connection->Key());
+      //  Entries are kept at zero so the next Checkout() for the same
+      //  key doesn't need to allocate.
+      if ((uit != _inUse.end()) && (uit->second > 0)) {
+        --uit->second;
+      }
+      if (connection->Reusable()) {
+        _idle[connection->Key()].push_back(std::move(connection));
+      }
+      else {
+        discard = std::move(connection);
+      }
+      _cv.notify_all();
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ConnectionPool::Prune(ConnectionList & connections,
+                               Discards & expired)
+    {
+      auto  oldest = Connection::Clock::now() - _idleTimeout;
+      while ((! connections.empty())
+             && (connections.front()->LastUsed() < oldest)) {
+        expired.push_back(std::move(connections.front()));
+        connections.pop_front();
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ConnectionPool::Prune()
+    {
+      Discards  expired;
+      std::vector<std::shared_ptr<Http2Session>>  expiredSessions;
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  oldest = Connection::Clock::now() - _idleTimeout;
+      for (auto it = _http2.begin(); it != _http2.end(); ) {
+        if ((! it->second->Usable())
+            || ((it->second->ActiveStreams() == 0)
+                && (it->second->LastUsed() < oldest))) {
+          expiredSessions.push_back(std::move(it->second));
+          it = _http2.erase(it);
+        }
+        else {
+          ++it;
+        }
+      }
+      for (auto it = _idle.begin(); it != _idle.end(); ) {
+        Prune(it->second, expired);
+        if (it->second.empty()) {
+          it = _idle.erase(it);
+        }
+        else {
+          ++it;
+        }
+      }
+      _cv.notify_all();
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ConnectionPool::Clear()
+    {
+      std::map<ConnectionKey,ConnectionList>  idle;
+      std::map<ConnectionKey,std::shared_ptr<Http2Session>>  sessions;
+      {
+        std::lock_guard<std::mutex>  lck(_mtx);
+        idle.swap(_idle);
+        //  Sessions in use by other threads stay alive until they're done.
+        sessions.swap(_http2);
+        _cv.notify_all();
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ConnectionPool::IdleConnections() const
+    {
+      size_t  rc = 0;
+      std::lock_guard<std::mutex>  lck(_mtx);
+      for (const auto & idle : _idle) {
+        rc += idle.second.size();
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ConnectionPool::Http2Sessions() const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _http2.size();
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
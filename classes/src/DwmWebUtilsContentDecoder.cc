@@ -0,0 +1,377 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsContentDecoder.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ContentDecoder class implementation
+//---------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include <zlib.h>
+#ifdef DWM_HAVE_BROTLI
+  #include <brotli/decode.h>
+#endif
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsContentDecoder.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    struct ContentDecoder::Impl
+    {
+      typedef enum {
+        e_none,
+        e_gzip,
+        e_deflate,
+        e_br
+      } Coding;
+
+      Coding                   coding;
+      z_stream                 zs;
+      bool                     zInit;
+      int                      zWindowBits;
+      std::string              pending;
+#ifdef DWM_HAVE_BROTLI
+      BrotliDecoderState      *br;
+#endif
+      bool                     started;
+      bool                     done;
+      std::unique_ptr<char[]>  out;
+
+      Impl()
+          : coding(e_none), zInit(false), zWindowBits(0), pending(),
+#ifdef DWM_HAVE_BROTLI
+            br(nullptr),
+#endif
+            started(false), done(false), out(new char[k_outputSize])
+      {
+        memset(&zs, 0, sizeof(zs));
+      }
+      
+      ~Impl()
+      {
+        Reset();
+        if (zWindowBits) {
+          inflateEnd(&zs);
+        }
+      }
+
+      //----------------------------------------------------------------------
+      //!  Keeps the zlib state (if any) so InitZlib() can reuse it.
+      //----------------------------------------------------------------------
+      void Reset()
+      {
+        zInit = false;
+#ifdef DWM_HAVE_BROTLI
+        if (br) {
+          BrotliDecoderDestroyInstance(br);
+          br = nullptr;
+        }
+#endif
+        pending.clear();
+        started = false;
+        done = false;
+        coding = e_none;
+      }
+      
+      bool InitZlib(int windowBits)
+      {
+        if (zWindowBits == windowBits) {
+          //  Reuse the state (and its window) from a previous body.
+          if (inflateReset(&zs) == Z_OK) {
+            zInit = true;
+            return true;
+          }
+        }
+        if (zWindowBits) {
+          inflateEnd(&zs);
+          memset(&zs, 0, sizeof(zs));
+          zWindowBits = 0;
+        }
+        if (inflateInit2(&zs, windowBits) != Z_OK) {
+          Syslog(LOG_ERR, "inflateInit2() failed");
+          return false;
+        }
+        zWindowBits = windowBits;
+        zInit = true;
+        return true;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  "deflate" is supposed to be zlib-wrapped (RFC 9110), but some
+      //!  servers send raw deflate.  Tell them apart by the zlib header.
+      //----------------------------------------------------------------------
+      bool InitDeflate()
+      {
+        auto  cmf = (unsigned char)pending[0];
+        auto  flg = (unsigned char)pending[1];
+        bool  zlibWrapped = (((cmf & 0x0f) == 8)
+                             && ((((unsigned)cmf << 8) | flg) % 31 == 0));
+        return InitZlib(zlibWrapped ? 15 : -15);
+      }
+      
+      bool DecodeZlib(std::string_view encoded, const Output & output)
+      {
+        zs.next_in = (Bytef *)encoded.data();
+        zs.avail_in = encoded.size();
+        while ((zs.avail_in > 0) || (zs.avail_out == 0)) {
+          if (done) {
+            //  Concatenated gzip members are allowed; anything else
+            //  after the end of the stream is ignored.
+            if ((coding == e_gzip) && (zs.avail_in > 0)
+                && (*zs.next_in == 0x1f)) {
+              inflateReset(&zs);
+              done = false;
+            }
+            else {
+              break;
+            }
+          }
+          zs.next_out = (Bytef *)out.get();
+          zs.avail_out = k_outputSize;
+          int  rc = inflate(&zs, Z_NO_FLUSH);
+          if (rc == Z_STREAM_END) {
+            done = true;
+          }
+          else if ((rc != Z_OK) && (rc != Z_BUF_ERROR)) {
+            Syslog(LOG_ERR, "inflate() failed: %d (%s)", rc,
+                   zs.msg ? zs.msg : "");
+            return false;
+          }
+          size_t  len = k_outputSize - zs.avail_out;
+          if (len && (! output(std::string_view(out.get(), len)))) {
+            return false;
+          }
+          if ((rc == Z_BUF_ERROR) && (len == 0)) {
+            break;
+          }
+        }
+        return true;
+      }
+
+#ifdef DWM_HAVE_BROTLI
+      bool DecodeBrotli(std::string_view encoded, const Output & output)
+      {
+        const uint8_t  *nextIn = (const uint8_t *)encoded.data();
+        size_t          availIn = encoded.size();
+        while (! done) {
+          uint8_t  *nextOut = (uint8_t *)out.get();
+          size_t    availOut = k_outputSize;
+          auto  rc = BrotliDecoderDecompressStream(br, &availIn, &nextIn,
+                                                   &availOut, &nextOut,
+                                                   nullptr);
+          size_t  len = k_outputSize - availOut;
+          if (len && (! output(std::string_view(out.get(), len)))) {
+            return false;
+          }
+          if (rc == BROTLI_DECODER_RESULT_ERROR) {
+            auto  err = BrotliDecoderGetErrorCode(br);
+            Syslog(LOG_ERR, "brotli decode failed: %s",
+                   BrotliDecoderErrorString(err));
+            return false;
+          }
+          if (rc == BROTLI_DECODER_RESULT_SUCCESS) {
+            done = true;
+          }
+          else if (rc == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT) {
+            break;
+          }
+        }
+        return true;
+      }
+#endif
+    };
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ContentDecoder::HaveBrotli()
+    {
+#ifdef DWM_HAVE_BROTLI
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    const std::string & ContentDecoder::AcceptEncoding()
+    {
+#ifdef DWM_HAVE_BROTLI
+      static const std::string  rc("gzip, deflate, br");
+#else
+      static const std::string  rc("gzip, deflate");
+#endif
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ContentDecoder::ContentDecoder()
+        : _impl(std::make_unique<Impl>())
+    {}
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ContentDecoder::~ContentDecoder() = default;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ContentDecoder::Begin(std::string_view contentEncoding)
+    {
+      _impl->Reset();
+      while ((! contentEncoding.empty())
+             && std::isspace((unsigned char)contentEncoding.front())) {
+        contentEncoding.remove_prefix(1);
+      }
+      while ((! contentEncoding.empty())
+             && std::isspace((unsigned char)contentEncoding.back())) {
+        contentEncoding.remove_suffix(1);
+      }
+      std::string  coding(contentEncoding);
+      std::transform(coding.begin(), coding.end(), coding.begin(),
+                     [] (unsigned char c) { return std::tolower(c); });
+      if ((coding == "gzip") || (coding == "x-gzip")) {
+        _impl->coding = Impl::e_gzip;
+        //  32: accept zlib-wrapped too, in case of a confused server.
+        return _impl->InitZlib(15 + 32);
+      }
+      if (coding == "deflate") {
+        //  Initialized when we have the first two bytes.
+        _impl->coding = Impl::e_deflate;
+        return true;
+      }
+#ifdef DWM_HAVE_BROTLI
+      if (coding == "br") {
+        _impl->br = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+        if (! _impl->br) {
+          Syslog(LOG_ERR, "BrotliDecoderCreateInstance() failed");
+          return false;
+        }
+        _impl->coding = Impl::e_br;
+        return true;
+      }
+#endif
+      if ((! coding.empty()) && (coding != "identity")) {
+        Syslog(LOG_ERR, "Unsupported Content-Encoding '%s'", coding.c_str());
+      }
+      return false;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ContentDecoder::Decode(std::string_view encoded,
+                                const Output & output)
+    {
+      if (! encoded.empty()) {
+        _impl->started = true;
+      }
+      switch (_impl->coding) {
+        case Impl::e_gzip:
+          return _impl->DecodeZlib(encoded, output);
+        case Impl::e_deflate:
+          if (! _impl->zInit) {
+            _impl->pending.append(encoded);
+            if (_impl->pending.size() < 2) {
+              return true;
+            }
+            if (! _impl->InitDeflate()) {
+              return false;
+            }
+            std::string  pending;
+            pending.swap(_impl->pending);
+            return _impl->DecodeZlib(pending, output);
+          }
+          return _impl->DecodeZlib(encoded, output);
+#ifdef DWM_HAVE_BROTLI
+        case Impl::e_br:
+          return _impl->DecodeBrotli(encoded, output);
+#endif
+        default:
+          break;
+      }
+      return false;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ContentDecoder::End()
+    {
+      //  An empty body is fine, whatever the Content-Encoding says.
+      bool  rc = (_impl->done || (! _impl->started));
+      if (! rc) {
+        Syslog(LOG_ERR, "Truncated encoded content");
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ContentDecoder::Decode(std::string_view contentEncoding,
+                                std::string_view encoded,
+                                std::string & decoded)
+    {
+      decoded.clear();
+      ContentDecoder  decoder;
+      if (! decoder.Begin(contentEncoding)) {
+        return false;
+      }
+      auto  append = [&] (std::string_view s) {
+        decoded.append(s);
+        return true;
+      };
+      return (decoder.Decode(encoded, append) && decoder.End());
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
@@ -0,0 +1,442 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsFastJson.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::FastJson class implementation
+//---------------------------------------------------------------------------
+
+#include <limits>
+
+#ifdef DWM_HAVE_SIMDJSON
+  #include <simdjson.h>
+#endif
+
+#include "DwmWebUtilsFastJson.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+#ifdef DWM_HAVE_SIMDJSON
+
+    namespace ondemand = simdjson::ondemand;
+    
+    const size_t  FastJson::k_padding = simdjson::SIMDJSON_PADDING;
+    
+    //------------------------------------------------------------------------
+    //!  Converts @c v (an ondemand document or value) to a nlohmann::json.
+    //------------------------------------------------------------------------
+    template <typename T>
+    static simdjson::error_code Convert(T & v, nlohmann::json & out)
+    {
+      ondemand::json_type  type;
+      simdjson::error_code  err = v.type().get(type);
+      if (err) {
+        return err;
+      }
+      switch (type) {
+        case ondemand::json_type::object:
+          {
+            ondemand::object  obj;
+            if ((err = v.get_object().get(obj))) {
+              return err;
+            }
+            out = nlohmann::json::object();
+            for (auto field : obj) {
+              std::string_view  key;
+              if ((err = field.unescaped_key().get(key))) {
+                return err;
+              }
+              auto  child = field.value();
+              if ((err = Convert(child, out[std::string(key)]))) {
+                return err;
+              }
+            }
+          }
+          break;
+        case ondemand::json_type::array:
+          {
+            ondemand::array  arr;
+            if ((err = v.get_array().get(arr))) {
+              return err;
+            }
+            out = nlohmann::json::array();
+            for (auto element : arr) {
+              nlohmann::json  child;
+              if ((err = Convert(element, child))) {
+                return err;
+              }
+              out.push_back(std::move(child));
+            }
+          }
+          break;
+        case ondemand::json_type::number:
+          {
+            ondemand::number_type  numType;
+            if ((err = v.get_number_type().get(numType))) {
+              return err;
+            }
+            if (numType == ondemand::number_type::signed_integer) {
+              int64_t  i;
+              if (! (err = v.get_int64().get(i))) {
+                out = i;
+              }
+            }
+            else if (numType == ondemand::number_type::unsigned_integer) {
+              uint64_t  u;
+              if (! (err = v.get_uint64().get(u))) {
+                out = u;
+              }
+            }
+            else {
+              double  d;
+              if (! (err = v.get_double().get(d))) {
+                out = d;
+              }
+            }
+          }
+          break;
+        case ondemand::json_type::string:
+          {
+            std::string_view  s;
+            if (! (err = v.get_string().get(s))) {
+              out = std::string(s);
+            }
+          }
+          break;
+        case ondemand::json_type::boolean:
+          {
+            bool  b;
+            if (! (err = v.get_bool().get(b))) {
+              out = b;
+            }
+          }
+          break;
+        case ondemand::json_type::null:
+          {
+            bool  isNull;
+            if (! (err = v.is_null().get(isNull))) {
+              out = nullptr;
+            }
+          }
+          break;
+        default:
+          err = simdjson::INCORRECT_TYPE;
+          break;
+      }
+      return err;
+    }
+
+    //------------------------------------------------------------------------
+    //!  simdjson on-demand parsing.
+    //------------------------------------------------------------------------
+    struct FastJson::Impl
+    {
+      ondemand::parser    parser;
+      ondemand::document  doc;
+
+      bool Parse(std::string & buffer)
+      {
+        size_t  needed = buffer.size() + simdjson::SIMDJSON_PADDING;
+        if (buffer.capacity() < needed) {
+          buffer.reserve(needed);
+        }
+        return (! parser.iterate(buffer.data(), buffer.size(),
+                                 buffer.capacity()).get(doc));
+      }
+      
+      bool Get(std::string_view pointer, std::string & value)
+      {
+        std::string_view  s;
+        if (doc.at_pointer(pointer).get_string().get(s)) {
+          return false;
+        }
+        value.assign(s.data(), s.size());
+        return true;
+      }
+      
+      template <typename T>
+      bool Get(std::string_view pointer, T & value)
+      {
+        T  v;
+        if (doc.at_pointer(pointer).get(v)) {
+          return false;
+        }
+        value = v;
+        return true;
+      }
+
+      bool Get(std::string_view pointer, nlohmann::json & value)
+      {
+        if (pointer.empty()) {
+          return ToJson(value);
+        }
+        ondemand::value  v;
+        if (doc.at_pointer(pointer).get(v)) {
+          return false;
+        }
+        nlohmann::json  json;
+        if (Convert(v, json)) {
+          return false;
+        }
+        value = std::move(json);
+        return true;
+      }
+      
+      bool ToJson(nlohmann::json & json)
+      {
+        nlohmann::json  result;
+        doc.rewind();
+        if (Convert(doc, result)) {
+          return false;
+        }
+        json = std::move(result);
+        return true;
+      }
+    };
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::HaveSimdJson()
+    {
+      return true;
+    }
+    
+#else
+
+    const size_t  FastJson::k_padding = 0;
+    
+    //------------------------------------------------------------------------
+    //!  Without simdjson, we parse into a DOM.
+    //------------------------------------------------------------------------
+    struct FastJson::Impl
+    {
+      nlohmann::json  dom;
+
+      bool Parse(std::string & buffer)
+      {
+        dom = nlohmann::json::parse(buffer, nullptr, false);
+        return (! dom.is_discarded());
+      }
+
+      const nlohmann::json *Find(std::string_view pointer) const
+      {
+        try {
+          nlohmann::json::json_pointer  ptr{std::string(pointer)};
+          if (dom.contains(ptr)) {
+            return &dom.at(ptr);
+          }
+        }
+        catch (...) {
+        }
+        return nullptr;
+      }
+      
+      bool Get(std::string_view pointer, std::string & value)
+      {
+        auto  v = Find(pointer);
+        if (v && v->is_string()) {
+          value = v->get_ref<const std::string &>();
+          return true;
+        }
+        return false;
+      }
+      
+      bool Get(std::string_view pointer, double & value)
+      {
+        auto  v = Find(pointer);
+        if (v && v->is_number()) {
+          value = v->get<double>();
+          return true;
+        }
+        return false;
+      }
+
+      bool Get(std::string_view pointer, int64_t & value)
+      {
+        auto  v = Find(pointer);
+        if (v && v->is_number_integer()
+            && ((! v->is_number_unsigned())
+                || (v->get<uint64_t>()
+                    <= (uint64_t)std::numeric_limits<int64_t>::max()))) {
+          value = v->get<int64_t>();
+          return true;
+        }
+        return false;
+      }
+
+      bool Get(std::string_view pointer, uint64_t & value)
+      {
+        auto  v = Find(pointer);
+        if (v && v->is_number_integer()
+            && (v->is_number_unsigned() || (v->get<int64_t>() >= 0))) {
+          value = v->get<uint64_t>();
+          return true;
+        }
+        return false;
+      }
+      
+      bool Get(std::string_view pointer, bool & value)
+      {
+        auto  v = Find(pointer);
+        if (v && v->is_boolean()) {
+          value = v->get<bool>();
+          return true;
+        }
+        return false;
+      }
+
+      bool Get(std::string_view pointer, nlohmann::json & value)
+      {
+        auto  v = Find(pointer);
+        if (v) {
+          value = *v;
+          return true;
+        }
+        return false;
+      }
+      
+      bool ToJson(nlohmann::json & json)
+      {
+        json = dom;
+        return true;
+      }
+    };
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::HaveSimdJson()
+    {
+      return false;
+    }
+    
+#endif
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    FastJson::FastJson()
+        : _buffer(), _impl(new Impl()), _parsed(false)
+    {}
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    FastJson::~FastJson()
+    {}
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Parse()
+    {
+      _parsed = _impl->Parse(_buffer);
+      return _parsed;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Parse(std::string_view json)
+    {
+      _buffer.clear();
+      _buffer.reserve(json.size() + k_padding);
+      _buffer.append(json);
+      return Parse();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Get(std::string_view pointer, std::string & value)
+    {
+      return (_parsed && _impl->Get(pointer, value));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Get(std::string_view pointer, double & value)
+    {
+      return (_parsed && _impl->Get(pointer, value));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Get(std::string_view pointer, int64_t & value)
+    {
+      return (_parsed && _impl->Get(pointer, value));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Get(std::string_view pointer, uint64_t & value)
+    {
+      return (_parsed && _impl->Get(pointer, value));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Get(std::string_view pointer, bool & value)
+    {
+      return (_parsed && _impl->Get(pointer, value));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::Get(std::string_view pointer, nlohmann::json & value)
+    {
+      return (_parsed && _impl->Get(pointer, value));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool FastJson::ToJson(nlohmann::json & json)
+    {
+      return (_parsed && _impl->ToJson(json));
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
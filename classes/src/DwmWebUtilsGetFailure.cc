@@ -64,6 +64,7 @@ namespace Dwm {
         case k_failNumAuth:     rc = e_failTypeAuthenticateServer;  break;
         case k_failNumGet:      rc = e_failTypeGet;                 break;
         case k_failNumJSON:     rc = e_failTypeJSON;                break;
+        case k_failNumTimeout:  rc = e_failTypeTimeout;             break;
         default:
           if ((100 <= _failNum) && (1000 > _failNum)) {
             rc = e_failTypeGet;
@@ -101,6 +102,9 @@ namespace Dwm {
         case e_failTypeJSON:
           rc = "JSON";
           break;
+        case e_failTypeTimeout:
+          rc = "TIMEOUT";
+          break;
         case e_failTypeOther:
           rc = std::to_string(_failNum);
           break;
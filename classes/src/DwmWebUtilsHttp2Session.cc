@@ -0,0 +1,1060 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsHttp2Session.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::Http2Session class implementation
+//---------------------------------------------------------------------------
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef DWM_HAVE_NGHTTP2
+  #include <nghttp2/nghttp2.h>
+#endif
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsContentDecoder.hh"
+#include "DwmWebUtilsHttp2Session.hh"
+#include "DwmWebUtilsResponseCache.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace asio = boost::asio;
+    namespace beast = boost::beast;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void Http2Session::OfferHttp2(Connection & connection)
+    {
+      connection._offerHttp2 = true;
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    asio::ssl::stream<beast::tcp_stream> &
+    Http2Session::HttpsStream(Connection & connection)
+    {
+      return *connection._httpsStream;
+    }
+    
+#ifdef DWM_HAVE_NGHTTP2
+
+    using Clock = Connection::Clock;
+    
+    //------------------------------------------------------------------------
+    //!  One request.  Filled in on the session's thread, waited on by the
+    //!  requesting thread.
+    //------------------------------------------------------------------------
+    struct Stream
+    {
+      //----------------------------------------------------------------------
+      //!  A piece of the (decoded) body, and the number of bytes of DATA
+      //!  it came from (to give back to flow control when consumed).
+      //----------------------------------------------------------------------
+      struct Chunk
+      {
+        std::string  data;
+        size_t       received;
+      };
+      
+      std::mutex               mtx;
+      std::condition_variable  cv;
+      int32_t                  id = -1;
+      bool                     streaming = false;
+      bool                     informational = false;
+      bool                     headerDone = false;
+      bool                     done = false;
+      bool                     abandoned = false;
+      uint16_t                 failNum = GetFailure::k_failNumNone;
+      http::response_header<>  header;
+      std::string              body;
+      std::deque<Chunk>        chunks;
+      ContentDecoder           decoder;
+      bool                     decoding = false;
+      Clock::time_point        lastActivity = Clock::now();
+    };
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    struct Http2Session::Impl
+    {
+      typedef enum {
+        e_new,
+        e_opening,
+        e_open,
+        e_refused,
+        e_failed
+      } State;
+
+      //  Per-stream and connection flow control windows.  Big enough
+      //  that a fast reader is never waiting on WINDOW_UPDATEs.
+      static constexpr int32_t  k_streamWindow = 1024 * 1024;
+      static constexpr int32_t  k_connectionWindow = 16 * 1024 * 1024;
+      
+      ConnectionKey                                  key;
+      asio::io_context                               ioc;
+      asio::executor_work_guard<asio::io_context::executor_type>  work;
+      std::thread                                    thread;
+      std::unique_ptr<Connection>                    connection;
+      nghttp2_session                               *session;
+
+      //  Guards state, openFailure and lastUsed.
+      mutable std::mutex                             mtx;
+      std::condition_variable                        cv;
+      State                                          state;
+      GetFailure                                     openFailure;
+      Clock::time_point                              lastUsed;
+      std::atomic<bool>                              closed;
+      std::atomic<bool>                              goaway;
+      std::atomic<size_t>                            active;
+      std::atomic<uint64_t>                          requests;
+
+      //  Only touched on the session's thread.
+      std::map<int32_t,std::shared_ptr<Stream>>      streams;
+      std::string                                    outbuf;
+      bool                                           writing;
+      
+      Impl(const ConnectionKey & k)
+          : key(k), ioc(1), work(asio::make_work_guard(ioc)), thread(),
+            connection(), session(nullptr), mtx(), cv(), state(e_new),
+            openFailure(), lastUsed(Clock::now()), closed(false),
+            goaway(false), active(0), requests(0), streams(), outbuf(),
+            writing(false)
+      {
+        thread = std::thread([this] { ioc.run(); });
+      }
+
+      ~Impl()
+      {
+        std::promise<void>  shutdown;
+        auto  done = shutdown.get_future();
+        asio::co_spawn(ioc, AsyncShutdown(),
+                       [&] (std::exception_ptr) { shutdown.set_value(); });
+        done.wait();
+        work.reset();
+        ioc.stop();
+        thread.join();
+        if (session) {
+          nghttp2_session_del(session);
+        }
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<State> AsyncOpen(const RequestOptions & options,
+                                       GetFailure & failure)
+      {
+        connection = std::make_unique<Connection>(key, ioc.get_executor());
+        //  The connection outlives the request that opens it, so it
+        //  mustn't keep that request's metrics.
+        RequestOptions  connectionOptions(options);
+        connectionOptions.Metrics(nullptr);
+        connection->Options(connectionOptions);
+        Http2Session::OfferHttp2(*connection);
+        bool  opened = co_await connection->AsyncOpen(failure);
+        if (! opened) {
+          co_return e_failed;
+        }
+        if (connection->Protocol() != "h2") {
+          Syslog(LOG_INFO, "%s:%hu did not negotiate HTTP/2",
+                 key.Host().c_str(), key.Port());
+          co_await connection->AsyncClose();
+          co_return e_refused;
+        }
+        if (! InitSession()) {
+          failure.FailNum(GetFailure::k_failNumConnect);
+          co_await connection->AsyncClose();
+          co_return e_failed;
+        }
+        asio::co_spawn(ioc, ReadLoop(), asio::detached);
+        Flush();
+        co_return e_open;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      bool InitSession()
+      {
+        nghttp2_session_callbacks  *callbacks;
+        if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+          return false;
+        }
+        nghttp2_session_callbacks_set_on_header_callback(callbacks,
+                                                         OnHeader);
+        nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks,
+                                                             OnFrameRecv);
+        nghttp2_session_callbacks_set_on_data_chunk_recv_callback
+          (callbacks, OnDataChunkRecv);
+        nghttp2_session_callbacks_set_on_stream_close_callback
+          (callbacks, OnStreamClose);
+        nghttp2_option  *option;
+        nghttp2_option_new(&option);
+        //  We give back flow control credit as bodies are consumed.
+        nghttp2_option_set_no_auto_window_update(option, 1);
+        int  rv = nghttp2_session_client_new2(&session, callbacks, this,
+                                              option);
+        nghttp2_option_del(option);
+        nghttp2_session_callbacks_del(callbacks);
+        if (rv != 0) {
+          Syslog(LOG_ERR, "nghttp2_session_client_new2() failed: %s",
+                 nghttp2_strerror(rv));
+          session = nullptr;
+          return false;
+        }
+        nghttp2_settings_entry  settings[] = {
+          { NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, 100 },
+          { NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, k_streamWindow },
+          { NGHTTP2_SETTINGS_ENABLE_PUSH, 0 }
+        };
+        nghttp2_submit_settings(session, NGHTTP2_FLAG_NONE, settings,
+                                sizeof(settings) / sizeof(settings[0]));
+        nghttp2_session_set_local_window_size(session, NGHTTP2_FLAG_NONE,
+                                              0, k_connectionWindow);
+        return true;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  Moves whatever nghttp2 wants to send to outbuf, and starts a
+      //!  writer if one isn't running.
+      //----------------------------------------------------------------------
+      void Flush()
+      {
+        if ((! session) || closed) {
+          return;
+        }
+        for (;;) {
+          const uint8_t  *data;
+          ssize_t  len = nghttp2_session_mem_send(session, &data);
+          if (len < 0) {
+            Syslog(LOG_ERR, "nghttp2_session_mem_send() failed: %s",
+                   nghttp2_strerror(len));
+            Terminate();
+            return;
+          }
+          if (len == 0) {
+            break;
+          }
+          outbuf.append((const char *)data, len);
+        }
+        if ((! outbuf.empty()) && (! writing)) {
+          writing = true;
+          asio::co_spawn(ioc, WriteLoop(), asio::detached);
+        }
+        return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<void> WriteLoop()
+      {
+        auto  & stream = Http2Session::HttpsStream(*connection);
+        boost::system::error_code  ec;
+        std::string  out;
+        while ((! ec) && (! outbuf.empty()) && (! closed)) {
+          out.clear();
+          out.swap(outbuf);
+          co_await asio::async_write(stream, asio::buffer(out),
+                                     asio::redirect_error(asio::use_awaitable,
+                                                          ec));
+        }
+        writing = false;
+        if (ec) {
+          Terminate();
+        }
+        co_return;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<void> ReadLoop()
+      {
+        auto  & stream = Http2Session::HttpsStream(*connection);
+        std::vector<char>  buf(Connection::k_bodyChunkSize);
+        boost::system::error_code  ec;
+        auto  token = asio::redirect_error(asio::use_awaitable, ec);
+        while (! closed) {
+          size_t  len = co_await stream.async_read_some(asio::buffer(buf),
+                                                        token);
+          if (ec || closed) {
+            break;
+          }
+          ssize_t  rv = nghttp2_session_mem_recv(session,
+                                                 (const uint8_t *)buf.data(),
+                                                 len);
+          if (rv < 0) {
+            Syslog(LOG_ERR, "nghttp2_session_mem_recv() failed: %s",
+                   nghttp2_strerror(rv));
+            break;
+          }
+          Flush();
+          if ((! nghttp2_session_want_read(session))
+              && (! nghttp2_session_want_write(session))) {
+            break;
+          }
+        }
+        Terminate();
+        co_return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  Fails all outstanding streams and closes the socket.  The
+      //!  session can't be used afterward.
+      //----------------------------------------------------------------------
+      void Terminate()
+      {
+        if (closed.exchange(true)) {
+          return;
+        }
+        auto  victims = std::move(streams);
+        streams.clear();
+        for (auto & victim : victims) {
+          Finish(*victim.second, GetFailure::k_failNumGet);
+        }
+        boost::system::error_code  ec;
+        beast::get_lowest_layer(Http2Session::HttpsStream(*connection))
+          .socket().close(ec);
+        return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      asio::awaitable<void> AsyncShutdown()
+      {
+        if ((! connection) || (! session) || closed) {
+          co_return;
+        }
+        nghttp2_session_terminate_session(session, NGHTTP2_NO_ERROR);
+        Flush();
+        //  Let the GOAWAY go out before the TLS shutdown.
+        asio::steady_timer  timer(ioc);
+        for (int i = 0; writing && (i < 100); ++i) {
+          timer.expires_after(std::chrono::milliseconds(10));
+          co_await timer.async_wait(asio::use_awaitable);
+        }
+        auto  victims = std::move(streams);
+        streams.clear();
+        for (auto & victim : victims) {
+          Finish(*victim.second, GetFailure::k_failNumGet);
+        }
+        closed = true;
+        co_await connection->AsyncClose();
+        co_return;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  Marks @c stream done, with failure @c failNum unless it already
+      //!  failed.
+      //----------------------------------------------------------------------
+      void Finish(Stream & stream, uint16_t failNum)
+      {
+        std::lock_guard<std::mutex>  lck(stream.mtx);
+        if (stream.done) {
+          return;
+        }
+        if (stream.failNum == GetFailure::k_failNumNone) {
+          stream.failNum = failNum;
+        }
+        stream.done = true;
+        stream.cv.notify_all();
+        --active;
+        return;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  Sends a request for @c url, from any thread.  The returned
+      //!  stream is done (and failed) if the session has failed.
+      //----------------------------------------------------------------------
+      std::shared_ptr<Stream> Submit(const Url & url,
+                                     const RequestOptions & options,
+                                     const ResponseCache::Entry * cached,
+                                     bool streaming)
+      {
+        auto  stream = std::make_shared<Stream>();
+        stream->streaming = streaming;
+        std::string  authority = key.Host();
+        if (key.Port() != 443) {
+          authority += ':' + std::to_string(key.Port());
+        }
+        std::vector<std::pair<std::string,std::string>>  headers = {
+          { ":method", "GET" },
+          { ":scheme", "https" },
+          { ":authority", authority },
+          { ":path", url.AfterAuthority() },
+          { "user-agent", "mcrover/1.0" }
+        };
+        if (options.Compression()) {
+          headers.push_back({ "accept-encoding",
+                              ContentDecoder::AcceptEncoding() });
+        }
+        if (cached) {
+          if (! cached->etag.empty()) {
+            headers.push_back({ "if-none-match", cached->etag });
+          }
+          if (! cached->lastModified.empty()) {
+            headers.push_back({ "if-modified-since", cached->lastModified });
+          }
+        }
+        ++active;
+        {
+          std::lock_guard<std::mutex>  lck(mtx);
+          lastUsed = Clock::now();
+        }
+        asio::post(ioc, [this, stream, headers = std::move(headers)] () {
+          if (closed) {
+            Finish(*stream, GetFailure::k_failNumGet);
+            return;
+          }
+          std::vector<nghttp2_nv>  nva;
+          for (const auto & hdr : headers) {
+            nva.push_back({ (uint8_t *)hdr.first.data(),
+                            (uint8_t *)hdr.second.data(),
+                            hdr.first.size(), hdr.second.size(),
+                            NGHTTP2_NV_FLAG_NONE });
+          }
+          int32_t  id = nghttp2_submit_request(session, nullptr, nva.data(),
+                                               nva.size(), nullptr,
+                                               stream.get());
+          if (id < 0) {
+            Syslog(LOG_ERR, "nghttp2_submit_request() failed: %s",
+                   nghttp2_strerror(id));
+            Finish(*stream, GetFailure::k_failNumGet);
+            return;
+          }
+          stream->id = id;
+          streams[id] = stream;
+          Flush();
+        });
+        return stream;
+      }
+
+      //----------------------------------------------------------------------
+      //!  Abandons @c stream: resets it and gives back the flow control
+      //!  credit for anything received but not consumed.
+      //----------------------------------------------------------------------
+      void Abandon(const std::shared_ptr<Stream> & stream)
+      {
+        asio::post(ioc, [this, stream] () {
+          size_t  unconsumed = 0;
+          {
+            std::lock_guard<std::mutex>  lck(stream->mtx);
+            stream->abandoned = true;
+            for (const auto & chunk : stream->chunks) {
+              unconsumed += chunk.received;
+            }
+            stream->chunks.clear();
+          }
+          if (closed || (stream->id < 0)) {
+            return;
+          }
+          if (unconsumed) {
+            nghttp2_session_consume(session, stream->id, unconsumed);
+          }
+          if (streams.find(stream->id) != streams.end()) {
+            nghttp2_submit_rst_stream(session, NGHTTP2_FLAG_NONE,
+                                      stream->id, NGHTTP2_CANCEL);
+          }
+          Flush();
+        });
+        return;
+      }
+
+      //----------------------------------------------------------------------
+      //!  Gives back @c len bytes of flow control credit for @c stream.
+      //----------------------------------------------------------------------
+      void Consume(const std::shared_ptr<Stream> & stream, size_t len)
+      {
+        asio::post(ioc, [this, stream, len] () {
+          if ((! closed) && (stream->id >= 0)) {
+            nghttp2_session_consume(session, stream->id, len);
+            Flush();
+          }
+        });
+        return;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  Waits until @c pred() is true (called with @c stream.mtx held by
+      //!  @c lck), or a timeout from @c options expires.  Returns false
+      //!  on timeout, after abandoning the stream.
+      //----------------------------------------------------------------------
+      template <typename Pred>
+      bool Wait(const std::shared_ptr<Stream> & stream,
+                std::unique_lock<std::mutex> & lck,
+                const RequestOptions & options, Clock::time_point start,
+                Pred pred)
+      {
+        while (! pred()) {
+          auto  deadline = Clock::time_point::max();
+          if (options.TotalTimeout().count()) {
+            deadline = start + options.TotalTimeout();
+          }
+          if (options.IdleReadTimeout().count()) {
+            deadline = std::min(deadline, (stream->lastActivity
+                                           + options.IdleReadTimeout()));
+          }
+          if (Clock::now() >= deadline) {
+            lck.unlock();
+            Abandon(stream);
+            lck.lock();
+            return false;
+          }
+          if (deadline == Clock::time_point::max()) {
+            stream->cv.wait(lck);
+          }
+          else {
+            stream->cv.wait_until(lck, deadline);
+          }
+        }
+        return true;
+      }
+      
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      static Stream *FindStream(nghttp2_session *session, int32_t id)
+      {
+        return (Stream *)nghttp2_session_get_stream_user_data(session, id);
+      }
+      
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      static int OnHeader(nghttp2_session *session,
+                          const nghttp2_frame *frame,
+                          const uint8_t *name, size_t namelen,
+                          const uint8_t *value, size_t valuelen,
+                          uint8_t flags, void *userData)
+      {
+        if (frame->hd.type != NGHTTP2_HEADERS) {
+          return 0;
+        }
+        Stream  *stream = FindStream(session, frame->hd.stream_id);
+        if (! stream) {
+          return 0;
+        }
+        std::string_view  n((const char *)name, namelen);
+        std::string_view  v((const char *)value, valuelen);
+        std::lock_guard<std::mutex>  lck(stream->mtx);
+        if (stream->headerDone) {
+          return 0;  // trailers
+        }
+        if (n == ":status") {
+          unsigned  status = 0;
+          for (char c : v) {
+            status = (status * 10) + (c - '0');
+          }
+          stream->informational = (status < 200);
+          if (! stream->informational) {
+            stream->header.result(status);
+          }
+        }
+        else if ((! n.empty()) && (n[0] != ':')
+                 && (! stream->informational)) {
+          stream->header.insert(n, v);
+        }
+        return 0;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      static int OnFrameRecv(nghttp2_session *session,
+                             const nghttp2_frame *frame, void *userData)
+      {
+        Impl  *impl = (Impl *)userData;
+        if (frame->hd.type == NGHTTP2_GOAWAY) {
+          impl->goaway = true;
+          return 0;
+        }
+        if ((frame->hd.type != NGHTTP2_HEADERS)
+            || (! (frame->hd.flags & NGHTTP2_FLAG_END_HEADERS))) {
+          return 0;
+        }
+        Stream  *stream = FindStream(session, frame->hd.stream_id);
+        if (! stream) {
+          return 0;
+        }
+        std::lock_guard<std::mutex>  lck(stream->mtx);
+        if (stream->informational) {
+          stream->informational = false;
+          return 0;
+        }
+        if (! stream->headerDone) {
+          stream->headerDone = true;
+          stream->header.version(20);
+          auto  ce = stream->header.find(http::field::content_encoding);
+          if ((ce != stream->header.end())
+              && stream->decoder.Begin(ce->value())) {
+            stream->decoding = true;
+            stream->header.erase(http::field::content_encoding);
+            stream->header.erase(http::field::content_length);
+          }
+          stream->lastActivity = Clock::now();
+          stream->cv.notify_all();
+        }
+        return 0;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      static int OnDataChunkRecv(nghttp2_session *session, uint8_t flags,
+                                 int32_t streamId, const uint8_t *data,
+                                 size_t len, void *userData)
+      {
+        Stream  *stream = FindStream(session, streamId);
+        if (! stream) {
+          nghttp2_session_consume(session, streamId, len);
+          return 0;
+        }
+        std::string_view  encoded((const char *)data, len);
+        std::unique_lock<std::mutex>  lck(stream->mtx);
+        stream->lastActivity = Clock::now();
+        bool  consumeNow = ((! stream->streaming) || stream->abandoned);
+        bool  ok = true;
+        if (! stream->abandoned) {
+          std::string  *out = &stream->body;
+          if (stream->streaming) {
+            stream->chunks.push_back({ std::string(), len });
+            out = &stream->chunks.back().data;
+          }
+          if (stream->decoding) {
+            ok = stream->decoder.Decode(encoded,
+                                        [out] (std::string_view s)
+                                        { out->append(s); return true; });
+          }
+          else {
+            out->append(encoded);
+          }
+          stream->cv.notify_all();
+        }
+        if (! ok) {
+          stream->failNum = GetFailure::k_failNumGet;
+          stream->abandoned = true;
+          for (const auto & chunk : stream->chunks) {
+            nghttp2_session_consume(session, streamId, chunk.received);
+          }
+          stream->chunks.clear();
+          consumeNow = (! stream->streaming);
+          lck.unlock();
+          nghttp2_submit_rst_stream(session, NGHTTP2_FLAG_NONE, streamId,
+                                    NGHTTP2_INTERNAL_ERROR);
+        }
+        else {
+          lck.unlock();
+        }
+        if (consumeNow) {
+          nghttp2_session_consume(session, streamId, len);
+        }
+        return 0;
+      }
+
+      //----------------------------------------------------------------------
+      //!  
+      //----------------------------------------------------------------------
+      static int OnStreamClose(nghttp2_session *session, int32_t streamId,
+                               uint32_t errorCode, void *userData)
+      {
+        Impl  *impl = (Impl *)userData;
+        auto  it = impl->streams.find(streamId);
+        if (it == impl->streams.end()) {
+          return 0;
+        }
+        auto  stream = it->second;
+        impl->streams.erase(it);
+        uint16_t  failNum = GetFailure::k_failNumNone;
+        {
+          std::lock_guard<std::mutex>  lck(stream->mtx);
+          if (errorCode != NGHTTP2_NO_ERROR) {
+            failNum = GetFailure::k_failNumGet;
+          }
+          else if (! stream->headerDone) {
+            failNum = GetFailure::k_failNumGet;
+          }
+          else if (stream->decoding && (! stream->abandoned)
+                   && (! stream->decoder.End())) {
+            failNum = GetFailure::k_failNumGet;
+          }
+        }
+        if (failNum == GetFailure::k_failNumNone) {
+          ++impl->requests;
+        }
+        impl->Finish(*stream, failNum);
+        return 0;
+      }
+    };
+
+    //------------------------------------------------------------------------
+    //!  A streambuf that delivers a stream's body as the reader consumes
+    //!  it, giving flow control credit back to the server as it goes.
+    //------------------------------------------------------------------------
+    class Http2BodyStreamBuf
+      : public std::streambuf
+    {
+    public:
+      using WaitFn =
+        std::function<bool(std::unique_lock<std::mutex> &,
+                           const std::function<bool()> &)>;
+      using ConsumeFn = std::function<void(size_t)>;
+      
+      Http2BodyStreamBuf(std::shared_ptr<Stream> stream, WaitFn wait,
+                         ConsumeFn consume)
+          : _stream(stream), _wait(wait), _consume(consume), _current(),
+            _timedOut(false)
+      {}
+
+      bool TimedOut() const
+      { return _timedOut; }
+      
+    protected:
+      int_type underflow() override
+      {
+        size_t  received = 0;
+        {
+          std::unique_lock<std::mutex>  lck(_stream->mtx);
+          auto  ready = [&] { return ((! _stream->chunks.empty())
+                                      || _stream->done); };
+          if (! _wait(lck, ready)) {
+            _timedOut = true;
+            return traits_type::eof();
+          }
+          if (_stream->chunks.empty()) {
+            return traits_type::eof();
+          }
+          _current.swap(_stream->chunks.front().data);
+          received = _stream->chunks.front().received;
+          _stream->chunks.pop_front();
+        }
+        _consume(received);
+        if (_current.empty()) {
+          return underflow();
+        }
+        setg(_current.data(), _current.data(),
+             _current.data() + _current.size());
+        return traits_type::to_int_type(*gptr());
+      }
+
+    private:
+      std::shared_ptr<Stream>  _stream;
+      WaitFn                   _wait;
+      ConsumeFn                _consume;
+      std::string              _current;
+      bool                     _timedOut;
+    };
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Http2Session::Supported()
+    {
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Http2Session::Http2Session(const ConnectionKey & key)
+        : _key(key), _impl(std::make_unique<Impl>(key))
+    {}
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Http2Session::~Http2Session() = default;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Http2Session::Open(const RequestOptions & options,
+                            GetFailure & failure)
+    {
+      std::unique_lock<std::mutex>  lck(_impl->mtx);
+      if (_impl->state == Impl::e_new) {
+        _impl->state = Impl::e_opening;
+        lck.unlock();
+        std::promise<Impl::State>  promise;
+        auto  result = promise.get_future();
+        GetFailure  openFailure;
+        asio::co_spawn(_impl->ioc, _impl->AsyncOpen(options, openFailure),
+                       [&] (std::exception_ptr ep, Impl::State state)
+                       { promise.set_value(ep ? Impl::e_failed : state); });
+        Impl::State  state = result.get();
+        lck.lock();
+        _impl->state = state;
+        _impl->openFailure = openFailure;
+        _impl->cv.notify_all();
+      }
+      else {
+        _impl->cv.wait(lck, [&] { return (_impl->state != Impl::e_opening); });
+      }
+      failure = _impl->openFailure;
+      return (_impl->state == Impl::e_open);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Http2Session::Refused() const
+    {
+      std::lock_guard<std::mutex>  lck(_impl->mtx);
+      return (_impl->state == Impl::e_refused);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Http2Session::Usable() const
+    {
+      std::lock_guard<std::mutex>  lck(_impl->mtx);
+      return (((_impl->state == Impl::e_open)
+               || (_impl->state == Impl::e_opening)
+               || (_impl->state == Impl::e_new))
+              && (! _impl->closed) && (! _impl->goaway));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Http2Session::Get(const Url & url,
+                           http::response<http::string_body> & response,
+                           GetFailure & failure,
+                           const RequestOptions & options)
+    {
+      auto  start = Clock::now();
+      auto  cache = options.Cache();
+      std::string  key;
+      std::shared_ptr<const ResponseCache::Entry>  cached;
+      if (cache) {
+        key = ResponseCache::Key(url.to_string());
+        cached = cache->Find(key);
+        if (cached && cached->Fresh()) {
+          cache->CountHit();
+          response = cached->response;
+          failure.FailNum(GetFailure::k_failNumNone);
+          return true;
+        }
+      }
+      auto  stream = _impl->Submit(url, options, cached.get(), false);
+      std::unique_lock<std::mutex>  lck(stream->mtx);
+      if (! _impl->Wait(stream, lck, options, start,
+                        [&] { return stream->done; })) {
+        failure.FailNum(GetFailure::k_failNumTimeout);
+        return false;
+      }
+      if (stream->failNum != GetFailure::k_failNumNone) {
+        failure.FailNum(stream->failNum);
+        return false;
+      }
+      response = http::response<http::string_body>();
+      response.base() = std::move(stream->header);
+      response.body() = std::move(stream->body);
+      response.prepare_payload();
+      lck.unlock();
+      if (cache) {
+        auto  entry = cache->Update(key, response);
+        if (entry && (response.result() == http::status::not_modified)) {
+          response = entry->response;
+        }
+      }
+      failure.FailNum(GetFailure::k_failNumNone);
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Http2Session::Get(const Url & url, http::response_header<> & header,
+                           const BodyReader & reader, GetFailure & failure,
+                           const RequestOptions & options)
+    {
+      auto  start = Clock::now();
+      auto  stream = _impl->Submit(url, options, nullptr, true);
+      auto  wait = [&] (std::unique_lock<std::mutex> & lck,
+                        const std::function<bool()> & pred)
+      { return _impl->Wait(stream, lck, options, start, pred); };
+      {
+        std::unique_lock<std::mutex>  lck(stream->mtx);
+        if (! wait(lck, [&] { return (stream->headerDone
+                                      || stream->done); })) {
+          failure.FailNum(GetFailure::k_failNumTimeout);
+          return false;
+        }
+        if (! stream->headerDone) {
+          failure.FailNum(stream->failNum);
+          return false;
+        }
+        header = stream->header;
+      }
+      
+      Http2BodyStreamBuf  sbuf(stream, wait,
+                               [&] (size_t len)
+                               { _impl->Consume(stream, len); });
+      failure.FailNum(GetFailure::k_failNumNone);
+      std::istream  is(&sbuf);
+      bool  accepted = reader(is);
+      bool  timedOut = sbuf.TimedOut();
+      if ((! accepted) || timedOut) {
+        _impl->Abandon(stream);
+      }
+      else {
+        //  Discard whatever the reader didn't want, so we know how the
+        //  request ended.
+        while (is.ignore(Connection::k_bodyChunkSize)) { }
+        timedOut = sbuf.TimedOut();
+      }
+      std::lock_guard<std::mutex>  lck(stream->mtx);
+      bool  requestFailed =
+        (stream->done && (stream->failNum != GetFailure::k_failNumNone));
+      bool  rc = false;
+      if (timedOut) {
+        failure.FailNum(GetFailure::k_failNumTimeout);
+      }
+      else if (accepted || requestFailed) {
+        //  If the request failed before the reader gave up, that's why
+        //  the reader gave up.
+        failure.FailNum(stream->failNum);
+        rc = (accepted && (! requestFailed));
+      }
+      else if (! failure) {
+        //  The reader rejected the body.  Leave any failure it set.
+        failure.FailNum(GetFailure::k_failNumGet);
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t Http2Session::ActiveStreams() const
+    {
+      return _impl->active;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    uint64_t Http2Session::Requests() const
+    {
+      return _impl->requests;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Connection::Clock::time_point Http2Session::LastUsed() const
+    {
+      std::lock_guard<std::mutex>  lck(_impl->mtx);
+      return _impl->lastUsed;
+    }
+    
+#else  // DWM_HAVE_NGHTTP2
+
+    //------------------------------------------------------------------------
+    //!  Without nghttp2, a session can never be opened.
+    //------------------------------------------------------------------------
+    struct Http2Session::Impl
+    {};
+    
+    bool Http2Session::Supported()
+    { return false; }
+
+    Http2Session::Http2Session(const ConnectionKey & key)
+        : _key(key), _impl()
+    {}
+
+    Http2Session::~Http2Session() = default;
+
+    bool Http2Session::Open(const RequestOptions &, GetFailure & failure)
+    {
+      failure.FailNum(GetFailure::k_failNumConnect);
+      return false;
+    }
+
+    bool Http2Session::Refused() const
+    { return true; }
+
+    bool Http2Session::Usable() const
+    { return false; }
+
+    bool Http2Session::Get(const Url &, http::response<http::string_body> &,
+                           GetFailure & failure, const RequestOptions &)
+    {
+      failure.FailNum(GetFailure::k_failNumConnect);
+      return false;
+    }
+
+    bool Http2Session::Get(const Url &, http::response_header<> &,
+                           const BodyReader &, GetFailure & failure,
+                           const RequestOptions &)
+    {
+      failure.FailNum(GetFailure::k_failNumConnect);
+      return false;
+    }
+
+    size_t Http2Session::ActiveStreams() const
+    { return 0; }
+
+    uint64_t Http2Session::Requests() const
+    { return 0; }
+
+    Connection::Clock::time_point Http2Session::LastUsed() const
+    { return Connection::Clock::time_point(); }
+    
+#endif  // DWM_HAVE_NGHTTP2
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
@@ -0,0 +1,358 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsJsonProjection.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::JsonProjection class implementation
+//---------------------------------------------------------------------------
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsJsonProjection.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    JsonProjection::JsonProjection(const std::vector<std::string> & pointers)
+        : _pointers(), _path(), _skipDepth(0), _capture(), _captureKey(),
+          _result()
+    {
+      for (const auto & pointer : pointers) {
+        std::vector<std::string>  tokens;
+        if (ParsePointer(pointer, tokens)) {
+          _pointers.push_back(std::move(tokens));
+        }
+        else {
+          Syslog(LOG_ERR, "Invalid JSON pointer '%s'", pointer.c_str());
+        }
+      }
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::null()
+    {
+      return Scalar(nlohmann::json());
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::boolean(bool val)
+    {
+      return Scalar(nlohmann::json(val));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::number_integer(number_integer_t val)
+    {
+      return Scalar(nlohmann::json(val));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::number_unsigned(number_unsigned_t val)
+    {
+      return Scalar(nlohmann::json(val));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::number_float(number_float_t val, const string_t &)
+    {
+      return Scalar(nlohmann::json(val));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::string(string_t & val)
+    {
+      if (_skipDepth) {
+        return true;  // don't bother copying
+      }
+      return Scalar(nlohmann::json(std::move(val)));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::binary(binary_t & val)
+    {
+      if (_skipDepth) {
+        return true;
+      }
+      return Scalar(nlohmann::json::binary(std::move(val)));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::start_object(std::size_t)
+    {
+      return StartContainer(nlohmann::json::object(), false);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::key(string_t & val)
+    {
+      if (! _skipDepth) {
+        if (! _capture.empty()) {
+          _captureKey = std::move(val);
+        }
+        else if (! _path.empty()) {
+          _path.back().key = std::move(val);
+        }
+      }
+      return true;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::end_object()
+    {
+      return EndContainer();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::start_array(std::size_t)
+    {
+      return StartContainer(nlohmann::json::array(), true);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::end_array()
+    {
+      return EndContainer();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::parse_error(std::size_t, const std::string &,
+                                     const nlohmann::detail::exception &)
+    {
+      return false;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Splits @c pointer into its reference tokens, unescaping them.
+    //------------------------------------------------------------------------
+    bool JsonProjection::ParsePointer(const std::string & pointer,
+                                      std::vector<std::string> & tokens)
+    {
+      tokens.clear();
+      if (pointer.empty()) {
+        return true;  // the whole document
+      }
+      if (pointer[0] != '/') {
+        return false;
+      }
+      std::string  token;
+      for (size_t i = 1; i <= pointer.size(); ++i) {
+        if ((i == pointer.size()) || (pointer[i] == '/')) {
+          tokens.push_back(std::move(token));
+          token.clear();
+        }
+        else if (pointer[i] == '~') {
+          if ((i + 1) < pointer.size()) {
+            if (pointer[i+1] == '0') {
+              token += '~';
+            }
+            else if (pointer[i+1] == '1') {
+              token += '/';
+            }
+            else {
+              return false;
+            }
+            ++i;
+          }
+          else {
+            return false;
+          }
+        }
+        else {
+          token += pointer[i];
+        }
+      }
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Called at the start of each value that isn't inside a skipped or
+    //!  captured subtree.  Returns whether the value is selected, is on the
+    //!  way to a selected value, or can be skipped.
+    //------------------------------------------------------------------------
+    JsonProjection::Disposition JsonProjection::Begin()
+    {
+      if ((! _path.empty()) && _path.back().isArray) {
+        Frame  & top = _path.back();
+        top.key = std::to_string(top.index++);
+      }
+      Disposition  rc = Disposition::e_skip;
+      for (const auto & pointer : _pointers) {
+        if (pointer.size() < _path.size()) {
+          continue;
+        }
+        size_t  i = 0;
+        while ((i < _path.size()) && (pointer[i] == _path[i].key)) {
+          ++i;
+        }
+        if (i == _path.size()) {
+          if (pointer.size() == _path.size()) {
+            return Disposition::e_match;
+          }
+          rc = Disposition::e_descend;
+        }
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns the place in the result for the value at the current path.
+    //------------------------------------------------------------------------
+    nlohmann::json & JsonProjection::Target()
+    {
+      nlohmann::json  *rc = &_result;
+      for (const auto & frame : _path) {
+        if (frame.isArray) {
+          rc = &((*rc)[frame.index - 1]);
+        }
+        else {
+          rc = &((*rc)[frame.key]);
+        }
+      }
+      return *rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::Scalar(nlohmann::json && val)
+    {
+      if (_skipDepth) {
+        return true;
+      }
+      if (! _capture.empty()) {
+        nlohmann::json  *parent = _capture.back();
+        if (parent->is_array()) {
+          parent->push_back(std::move(val));
+        }
+        else {
+          (*parent)[_captureKey] = std::move(val);
+        }
+      }
+      else if (Begin() == Disposition::e_match) {
+        Target() = std::move(val);
+      }
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::StartContainer(nlohmann::json && val, bool isArray)
+    {
+      if (_skipDepth) {
+        ++_skipDepth;
+      }
+      else if (! _capture.empty()) {
+        nlohmann::json  *parent = _capture.back();
+        if (parent->is_array()) {
+          parent->push_back(std::move(val));
+          _capture.push_back(&parent->back());
+        }
+        else {
+          nlohmann::json  & child = (*parent)[_captureKey];
+          child = std::move(val);
+          _capture.push_back(&child);
+        }
+      }
+      else {
+        switch (Begin()) {
+          case Disposition::e_match:
+            {
+              nlohmann::json  & target = Target();
+              target = std::move(val);
+              _capture.push_back(&target);
+            }
+            break;
+          case Disposition::e_descend:
+            _path.push_back(Frame{isArray, 0, std::string()});
+            break;
+          default:
+            _skipDepth = 1;
+            break;
+        }
+      }
+      return true;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool JsonProjection::EndContainer()
+    {
+      if (_skipDepth) {
+        --_skipDepth;
+      }
+      else if (! _capture.empty()) {
+        _capture.pop_back();
+      }
+      else if (! _path.empty()) {
+        _path.pop_back();
+      }
+      return true;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
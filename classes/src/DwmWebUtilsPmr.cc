@@ -0,0 +1,92 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsPmr.cc
+//!  \author Daniel W. McRobb
+//!  \brief PmrJsonScope and MakePmrResponse() implementations
+//---------------------------------------------------------------------------
+
+#include <tuple>
+
+#include "DwmWebUtilsPmr.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    static thread_local std::pmr::memory_resource  *g_pmrJsonResource =
+      nullptr;
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    PmrResponse MakePmrResponse(std::pmr::memory_resource *resource)
+    {
+      std::pmr::polymorphic_allocator<char>  bodyAlloc(resource);
+      return PmrResponse(std::piecewise_construct,
+                         std::make_tuple(bodyAlloc),
+                         std::make_tuple(PmrAllocator<char>(resource)));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    PmrJsonScope::PmrJsonScope(std::pmr::memory_resource *resource)
+        : _prev(g_pmrJsonResource)
+    {
+      g_pmrJsonResource = resource;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    PmrJsonScope::~PmrJsonScope()
+    {
+      g_pmrJsonResource = _prev;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::pmr::memory_resource *PmrJsonScope::Current()
+    {
+      return (g_pmrJsonResource ? g_pmrJsonResource
+              : std::pmr::get_default_resource());
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
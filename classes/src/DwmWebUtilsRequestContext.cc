@@ -0,0 +1,237 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsRequestContext.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::RequestContext class implementation
+//---------------------------------------------------------------------------
+
+#include <cstring>
+#include <new>
+#include <tuple>
+
+#include "DwmWebUtilsRequestContext.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    RequestContext::Arena::Arena()
+        : _size(0)
+    {
+      memset(_free, 0, sizeof(_free));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    RequestContext::Arena::~Arena()
+    {
+      for (size_t i = 0; i < k_numBlockSizes; ++i) {
+        while (_free[i]) {
+          FreeBlock  *block = _free[i];
+          _free[i] = block->next;
+          ::operator delete(block);
+        }
+      }
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns the index of the free list for blocks of @c size bytes,
+    //!  or k_numBlockSizes if @c size is too big to pool.
+    //------------------------------------------------------------------------
+    size_t RequestContext::Arena::Index(size_t size)
+    {
+      size_t  idx = 0;
+      while ((idx < k_numBlockSizes)
+             && (size > ((size_t)1 << (idx + k_minBlockShift)))) {
+        ++idx;
+      }
+      return idx;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void *RequestContext::Arena::Allocate(size_t size)
+    {
+      size_t  idx = Index(size);
+      if (idx == k_numBlockSizes) {
+        return ::operator new(size);
+      }
+      if (_free[idx]) {
+        FreeBlock  *block = _free[idx];
+        _free[idx] = block->next;
+        return block;
+      }
+      size_t  blockSize = (size_t)1 << (idx + k_minBlockShift);
+      _size += blockSize;
+      return ::operator new(blockSize);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void RequestContext::Arena::Deallocate(void *p, size_t size) noexcept
+    {
+      size_t  idx = Index(size);
+      if (idx == k_numBlockSizes) {
+        ::operator delete(p);
+        return;
+      }
+      FreeBlock  *block = static_cast<FreeBlock *>(p);
+      block->next = _free[idx];
+      _free[idx] = block;
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    RequestContext::RequestContext()
+        : _arena(), _key(), _target(),
+          _request(std::piecewise_construct, std::make_tuple(),
+                   std::make_tuple(GetAllocator())),
+          _buffer(),
+          _response(std::piecewise_construct, std::make_tuple(),
+                    std::make_tuple(GetAllocator())),
+          _parser(), _decoded(), _decoder()
+    {
+      _request.method(http::verb::get);
+      _request.version(11);
+      _request.set(http::field::user_agent, "mcrover/1.0");
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    RequestContext::~RequestContext() = default;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    const ConnectionKey &
+    RequestContext::Key(const Url & url, bool verifyCertificate)
+    {
+      return _key.Assign(url, verifyCertificate);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Same request as MakeRequest() in DwmWebUtilsConnection.cc, built
+    //!  in place.
+    //------------------------------------------------------------------------
+    void RequestContext::Prepare(const Url & url, bool keepAlive,
+                                 bool compression)
+    {
+      _target.assign(url.Path());
+      if (! url.Query().empty()) {
+        _target += '?';
+        _target += url.Query();
+      }
+      if (! url.Fragment().empty()) {
+        _target += '#';
+        _target += url.Fragment();
+      }
+      _request.target(_target);
+      _request.keep_alive(keepAlive);
+      _request.set(http::field::host, url.Host());
+      if (compression) {
+        _request.set(http::field::accept_encoding,
+                     ContentDecoder::AcceptEncoding());
+      }
+      else {
+        _request.erase(http::field::accept_encoding);
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Hands the response message (and its body's storage) to a new
+    //!  parser, and discards anything left in the read buffer.
+    //------------------------------------------------------------------------
+    void RequestContext::StartResponse()
+    {
+      _buffer.consume(_buffer.size());
+      _response.clear();
+      _response.result(http::status::unknown);
+      _response.body().clear();
+      _parser.emplace(std::move(_response));
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Takes the response message back from the parser.
+    //------------------------------------------------------------------------
+    void RequestContext::FinishResponse()
+    {
+      _response = _parser->release();
+      _parser.reset();
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Same as DecodeBody() in DwmWebUtilsConnection.cc, but decodes into
+    //!  a reused string with a reused decoder.
+    //------------------------------------------------------------------------
+    bool RequestContext::DecodeBody()
+    {
+      auto  it = _response.find(http::field::content_encoding);
+      if (it == _response.end()) {
+        return true;
+      }
+      if (! _decoder.Begin(it->value())) {
+        return true;  // identity, or something we leave to the caller
+      }
+      _decoded.clear();
+      auto  append = [this] (std::string_view s) {
+        _decoded.append(s);
+        return true;
+      };
+      if (! (_decoder.Decode(_response.body(), append) && _decoder.End())) {
+        return false;
+      }
+      _response.body().swap(_decoded);
+      _response.erase(http::field::content_encoding);
+      _response.prepare_payload();
+      return true;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
@@ -0,0 +1,229 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsResolverCache.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ResolverCache class implementation
+//---------------------------------------------------------------------------
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsResolverCache.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace asio = boost::asio;
+    using tcp = boost::asio::ip::tcp;
+    
+    std::mutex                   ResolverCache::_mtx;
+    std::map<ResolverCache::Key,ResolverCache::Entry>  ResolverCache::_entries;
+    std::atomic<std::chrono::milliseconds>
+      ResolverCache::_positiveTTL(std::chrono::milliseconds(60000));
+    std::atomic<std::chrono::milliseconds>
+      ResolverCache::_negativeTTL(std::chrono::milliseconds(5000));
+    std::atomic<std::chrono::milliseconds>
+      ResolverCache::_refreshAhead(std::chrono::milliseconds(10000));
+    std::atomic<size_t>          ResolverCache::_maxEntries = 4096;
+    std::atomic<uint64_t>        ResolverCache::_hits = 0;
+    std::atomic<uint64_t>        ResolverCache::_negativeHits = 0;
+    std::atomic<uint64_t>        ResolverCache::_misses = 0;
+    std::atomic<uint64_t>        ResolverCache::_refreshes = 0;
+    std::atomic<uint64_t>        ResolverCache::_refreshFailures = 0;
+    //  Defined last so it's destroyed first, joining the refresh thread
+    //  before the entries it updates go away.
+    std::unique_ptr<asio::thread_pool>  ResolverCache::_refresher;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ResolverCache::Lookup(const std::string & host,
+                               const std::string & service, Results & results,
+                               boost::system::error_code & ec)
+    {
+      bool  rc = false;
+      Key   key(host, service);
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _entries.find(key);
+      if (it != _entries.end()) {
+        Clock::time_point  now = Clock::now();
+        if (it->second.expires > now) {
+          results = it->second.results;
+          ec = it->second.ec;
+          rc = true;
+          if (ec) {
+            ++_negativeHits;
+          }
+          else {
+            ++_hits;
+            std::chrono::milliseconds  ahead = _refreshAhead.load();
+            if ((ahead.count() > 0) && (! it->second.refreshing)
+                && ((it->second.expires - now) <= ahead)) {
+              it->second.refreshing = true;
+              ++_refreshes;
+              if (! _refresher) {
+                _refresher = std::make_unique<asio::thread_pool>(1);
+              }
+              asio::post(*_refresher, [key] { Refresh(key); });
+            }
+          }
+        }
+        else {
+          _entries.erase(it);
+        }
+      }
+      if (! rc) {
+        ++_misses;
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResolverCache::Insert(const std::string & host,
+                               const std::string & service,
+                               const Results & results,
+                               const boost::system::error_code & ec)
+    {
+      std::chrono::milliseconds  ttl(0);
+      if (! ec) {
+        ttl = _positiveTTL.load();
+      }
+      else if (IsNegative(ec)) {
+        ttl = _negativeTTL.load();
+      }
+      if ((ttl.count() > 0) && (_maxEntries > 0)) {
+        Key  key(host, service);
+        std::lock_guard<std::mutex>  lck(_mtx);
+        Clock::time_point  now = Clock::now();
+        if ((_entries.find(key) == _entries.end())
+            && (_entries.size() >= _maxEntries)) {
+          MakeRoom(now);
+        }
+        Entry  & entry = _entries[key];
+        entry.results = ec ? Results() : results;
+        entry.ec = ec;
+        entry.expires = now + ttl;
+        entry.refreshing = false;
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResolverCache::Clear()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      _entries.clear();
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ResolverCache::Size()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _entries.size();
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ResolverCache::IsNegative(const boost::system::error_code & ec)
+    {
+      //  Note host_not_found_try_again (EAI_AGAIN) is transient, so we
+      //  don't cache it.
+      return ((ec == asio::error::host_not_found)
+              || (ec == asio::error::service_not_found)
+              || (ec == asio::error::no_data));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Must be called with _mtx locked.
+    //------------------------------------------------------------------------
+    void ResolverCache::MakeRoom(Clock::time_point now)
+    {
+      for (auto it = _entries.begin(); it != _entries.end(); ) {
+        if (it->second.expires <= now) {
+          it = _entries.erase(it);
+        }
+        else {
+          ++it;
+        }
+      }
+      while ((! _entries.empty()) && (_entries.size() >= _maxEntries)) {
+        auto  oldest = _entries.begin();
+        for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+          if (it->second.expires < oldest->second.expires) {
+            oldest = it;
+          }
+        }
+        _entries.erase(oldest);
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Runs on the refresh thread.
+    //------------------------------------------------------------------------
+    void ResolverCache::Refresh(const Key & key)
+    {
+      asio::io_context           ioc;
+      tcp::resolver              resolver(ioc);
+      boost::system::error_code  ec;
+      Results  results = resolver.resolve(key.first, key.second, ec);
+      if (! ec) {
+        Insert(key.first, key.second, results, ec);
+      }
+      else {
+        ++_refreshFailures;
+        Syslog(LOG_DEBUG, "Failed to refresh resolution of %s:%s: %s",
+               key.first.c_str(), key.second.c_str(), ec.message().c_str());
+        std::lock_guard<std::mutex>  lck(_mtx);
+        auto  it = _entries.find(key);
+        if (it != _entries.end()) {
+          it->second.refreshing = false;
+        }
+      }
+      return;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
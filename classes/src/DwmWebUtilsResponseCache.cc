@@ -0,0 +1,437 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsResponseCache.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::ResponseCache class implementation
+//---------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsResponseCache.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace beast = boost::beast;
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    ResponseCache::ResponseCache(const std::string & directory)
+        : _directory(directory), _mtx(), _entries(), _maxEntries(1000),
+          _hits(0), _revalidations(0), _stores(0)
+    {}
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::shared_ptr<const ResponseCache::Entry>
+    ResponseCache::Find(const std::string & key)
+    {
+      {
+        std::lock_guard<std::mutex>  lck(_mtx);
+        auto  it = _entries.find(key);
+        if (it != _entries.end()) {
+          return it->second;
+        }
+      }
+      std::shared_ptr<const Entry>  entry;
+      if (! _directory.empty()) {
+        entry = Load(key);
+        if (entry) {
+          Insert(key, entry);
+        }
+      }
+      return entry;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::shared_ptr<const ResponseCache::Entry>
+    ResponseCache::Update(const std::string & key,
+                          const http::response<http::string_body> & response)
+    {
+      if (response.result() == http::status::not_modified) {
+        auto  cur = Find(key);
+        if (cur) {
+          ++_revalidations;
+          auto  entry = std::make_shared<Entry>(*cur);
+          entry->expires = Expires(response.base());
+          //  A 304 may carry updated validators.
+          auto  etag = response.find(http::field::etag);
+          if (etag != response.end()) {
+            entry->etag = etag->value();
+            entry->response.set(http::field::etag, entry->etag);
+          }
+          auto  lm = response.find(http::field::last_modified);
+          if (lm != response.end()) {
+            entry->lastModified = lm->value();
+            entry->response.set(http::field::last_modified,
+                                entry->lastModified);
+          }
+          Insert(key, entry);
+          if (! _directory.empty()) {
+            Save(key, *entry);
+          }
+          return entry;
+        }
+        return nullptr;
+      }
+
+      if (response.result() == http::status::ok) {
+        auto  entry = std::make_shared<Entry>();
+        auto  etag = response.find(http::field::etag);
+        if (etag != response.end()) {
+          entry->etag = etag->value();
+        }
+        auto  lm = response.find(http::field::last_modified);
+        if (lm != response.end()) {
+          entry->lastModified = lm->value();
+        }
+        auto  cc = response.find(http::field::cache_control);
+        std::string  cacheControl;
+        if (cc != response.end()) {
+          cacheControl = cc->value();
+          std::transform(cacheControl.begin(), cacheControl.end(),
+                         cacheControl.begin(),
+                         [] (unsigned char c) { return std::tolower(c); });
+        }
+        bool  storable =
+          ((cacheControl.find("no-store") == std::string::npos)
+           && ((! entry->etag.empty()) || (! entry->lastModified.empty())
+               || (cacheControl.find("max-age") != std::string::npos)));
+        if (storable) {
+          entry->expires = Expires(response.base());
+          entry->response = response;
+          ++_stores;
+          Insert(key, entry);
+          if (! _directory.empty()) {
+            Save(key, *entry);
+          }
+          return entry;
+        }
+      }
+      Erase(key);
+      return nullptr;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool ResponseCache::FindJson(const std::string & key,
+                                 nlohmann::json & json)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _entries.find(key);
+      if ((it != _entries.end()) && it->second->json) {
+        json = *(it->second->json);
+        return true;
+      }
+      return false;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResponseCache::StoreJson(const std::string & key,
+                                  const nlohmann::json & json)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _entries.find(key);
+      if (it != _entries.end()) {
+        auto  entry = std::make_shared<Entry>(*(it->second));
+        entry->json = std::make_shared<const nlohmann::json>(json);
+        it->second = entry;
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ResponseCache::MaxEntries() const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _maxEntries;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ResponseCache::MaxEntries(size_t maxEntries)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      _maxEntries = std::max(maxEntries, (size_t)1);
+      while (_entries.size() > _maxEntries) {
+        auto  victim =
+          std::min_element(_entries.begin(), _entries.end(),
+                           [] (const auto & a, const auto & b)
+                           { return (a.second->expires
+                                     < b.second->expires); });
+        _entries.erase(victim);
+      }
+      return _maxEntries;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResponseCache::Clear()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      if (! _directory.empty()) {
+        std::error_code  ec;
+        for (const auto & dirent
+               : std::filesystem::directory_iterator(_directory, ec)) {
+          if (dirent.path().extension() == ".dwmwebcache") {
+            std::filesystem::remove(dirent.path(), ec);
+          }
+        }
+      }
+      _entries.clear();
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ResponseCache::Size() const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _entries.size();
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResponseCache::Insert(const std::string & key,
+                               std::shared_ptr<const Entry> entry)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _entries.find(key);
+      if (it != _entries.end()) {
+        it->second = entry;
+        return;
+      }
+      if (_entries.size() >= _maxEntries) {
+        auto  victim =
+          std::min_element(_entries.begin(), _entries.end(),
+                           [] (const auto & a, const auto & b)
+                           { return (a.second->expires
+                                     < b.second->expires); });
+        _entries.erase(victim);
+      }
+      _entries[key] = entry;
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResponseCache::Erase(const std::string & key)
+    {
+      {
+        std::lock_guard<std::mutex>  lck(_mtx);
+        _entries.erase(key);
+      }
+      if (! _directory.empty()) {
+        std::error_code  ec;
+        std::filesystem::remove(Path(key), ec);
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Returns the path of the file for @c key.  The file name is the
+    //!  64-bit FNV-1a hash of the key, so it's stable across builds.
+    //------------------------------------------------------------------------
+    std::string ResponseCache::Path(const std::string & key) const
+    {
+      uint64_t  hash = 0xcbf29ce484222325ULL;
+      for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+      }
+      char  buf[17];
+      snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)hash);
+      return _directory + '/' + buf + ".dwmwebcache";
+    }
+    
+    //------------------------------------------------------------------------
+    //!  A cache file holds one line of JSON (the key and expiration time)
+    //!  followed by the response as received (headers and body).
+    //------------------------------------------------------------------------
+    std::shared_ptr<const ResponseCache::Entry>
+    ResponseCache::Load(const std::string & key) const
+    {
+      std::ifstream  is(Path(key), std::ios::binary);
+      if (! is) {
+        return nullptr;
+      }
+      std::string  line;
+      if (! std::getline(is, line)) {
+        return nullptr;
+      }
+      auto  meta = nlohmann::json::parse(line, nullptr, false);
+      if ((! meta.is_object()) || (! meta["key"].is_string())
+          || (meta["key"].get<std::string>() != key)
+          || (! meta["expires"].is_number_integer())) {
+        return nullptr;
+      }
+      std::stringstream  ss;
+      ss << is.rdbuf();
+      std::string  raw = ss.str();
+
+      http::response_parser<http::string_body>  parser;
+      parser.eager(true);
+      parser.body_limit(std::numeric_limits<std::uint64_t>::max());
+      beast::error_code  ec;
+      parser.put(boost::asio::buffer(raw), ec);
+      if (ec || (! parser.is_done())) {
+        Syslog(LOG_ERR, "Bad cache file %s for %s",
+               Path(key).c_str(), key.c_str());
+        return nullptr;
+      }
+      auto  entry = std::make_shared<Entry>();
+      entry->response = parser.release();
+      std::chrono::seconds  expires(meta["expires"].get<int64_t>());
+      entry->expires = Clock::time_point(expires);
+      auto  etag = entry->response.find(http::field::etag);
+      if (etag != entry->response.end()) {
+        entry->etag = etag->value();
+      }
+      auto  lm = entry->response.find(http::field::last_modified);
+      if (lm != entry->response.end()) {
+        entry->lastModified = lm->value();
+      }
+      return entry;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void ResponseCache::Save(const std::string & key,
+                             const Entry & entry) const
+    {
+      nlohmann::json  meta;
+      meta["key"] = key;
+      meta["expires"] = std::chrono::duration_cast<std::chrono::seconds>
+        (entry.expires.time_since_epoch()).count();
+      //  Write to a temporary file and rename, so readers never see a
+      //  partial file.
+      std::string  path = Path(key);
+      std::string  tmpPath = path + ".tmp";
+      {
+        std::ofstream  os(tmpPath, std::ios::binary | std::ios::trunc);
+        if (! os) {
+          Syslog(LOG_ERR, "Failed to open %s", tmpPath.c_str());
+          return;
+        }
+        //  Serialize with an explicit Content-Length and no chunking,
+        //  since the body is already decoded.
+        http::response<http::string_body>  rsp(entry.response);
+        rsp.chunked(false);
+        rsp.prepare_payload();
+        os << meta.dump() << '\n' << rsp;
+        if (! os) {
+          Syslog(LOG_ERR, "Failed to write %s", tmpPath.c_str());
+          return;
+        }
+      }
+      std::error_code  ec;
+      std::filesystem::rename(tmpPath, path, ec);
+      if (ec) {
+        Syslog(LOG_ERR, "Failed to rename %s: %s", tmpPath.c_str(),
+               ec.message().c_str());
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Returns the expiration time for a response with the given
+    //!  headers: now plus max-age less Age, or now (i.e. revalidate on
+    //!  every use) if there's no max-age or there's a no-cache directive.
+    //------------------------------------------------------------------------
+    ResponseCache::Clock::time_point
+    ResponseCache::Expires(const http::fields & fields)
+    {
+      auto  now = Clock::now();
+      auto  cc = fields.find(http::field::cache_control);
+      if (cc == fields.end()) {
+        return now;
+      }
+      std::string  cacheControl(cc->value());
+      std::transform(cacheControl.begin(), cacheControl.end(),
+                     cacheControl.begin(),
+                     [] (unsigned char c) { return std::tolower(c); });
+      if (cacheControl.find("no-cache") != std::string::npos) {
+        return now;
+      }
+      auto  pos = cacheControl.find("max-age=");
+      if (pos == std::string::npos) {
+        return now;
+      }
+      long long  maxAge = 0;
+      if (sscanf(cacheControl.c_str() + pos + 8, "%lld", &maxAge) != 1) {
+        return now;
+      }
+      auto  age = fields.find(http::field::age);
+      if (age != fields.end()) {
+        long long  ageSecs = 0;
+        if (sscanf(std::string(age->value()).c_str(), "%lld",
+                   &ageSecs) == 1) {
+          maxAge -= ageSecs;
+        }
+      }
+      if (maxAge <= 0) {
+        return now;
+      }
+      return now + std::chrono::seconds(maxAge);
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
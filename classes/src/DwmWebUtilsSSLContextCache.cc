@@ -0,0 +1,106 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsSSLContextCache.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::SSLContextCache class implementation
+//---------------------------------------------------------------------------
+
+#include <boost/certify/extensions.hpp>
+#include <boost/certify/https_verification.hpp>
+
+#include "DwmWebUtilsSSLContextCache.hh"
+#include "DwmWebUtilsTLSSessionCache.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    namespace ssl = boost::asio::ssl;
+
+    std::mutex                    SSLContextCache::_mtx;
+    std::shared_ptr<ssl::context> SSLContextCache::_verifyContext;
+    std::shared_ptr<ssl::context> SSLContextCache::_noVerifyContext;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static void InitializeSSLContext(ssl::context & sslctx, bool verifyCert)
+    {
+      if (verifyCert) {
+        sslctx.set_verify_mode(ssl::context::verify_peer |
+                               ssl::context::verify_fail_if_no_peer_cert);
+      }
+      else {
+        sslctx.set_verify_mode(ssl::verify_none);
+      }
+      sslctx.set_default_verify_paths();
+      boost::certify::enable_native_https_server_verification(sslctx);
+      TLSSessionCache::Enable(sslctx);
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::shared_ptr<ssl::context> SSLContextCache::Get(bool verifyCertificate)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      std::shared_ptr<ssl::context>  & ctx =
+        verifyCertificate ? _verifyContext : _noVerifyContext;
+      if (! ctx) {
+        ctx = std::make_shared<ssl::context>(ssl::context::tls_client);
+        InitializeSSLContext(*ctx, verifyCertificate);
+      }
+      return ctx;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void SSLContextCache::Reload()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      _verifyContext.reset();
+      _noVerifyContext.reset();
+      //  Sessions were verified against the old trust store.
+      TLSSessionCache::Clear();
+      return;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
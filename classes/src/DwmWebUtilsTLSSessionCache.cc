@@ -0,0 +1,177 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsTLSSessionCache.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::TLSSessionCache class implementation
+//---------------------------------------------------------------------------
+
+#include "DwmWebUtilsTLSSessionCache.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    std::mutex                            TLSSessionCache::_mtx;
+    std::map<ConnectionKey,SSL_SESSION *> TLSSessionCache::_sessions;
+    std::atomic<uint64_t>                 TLSSessionCache::_hits = 0;
+    std::atomic<uint64_t>                 TLSSessionCache::_misses = 0;
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int TLSSessionCache::KeyIndex()
+    {
+      static const int  idx =
+        SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+      return idx;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void TLSSessionCache::Enable(boost::asio::ssl::context & ctx)
+    {
+      SSL_CTX_set_session_cache_mode(ctx.native_handle(),
+                                     SSL_SESS_CACHE_CLIENT
+                                     | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+      SSL_CTX_sess_set_new_cb(ctx.native_handle(), NewSessionCallback);
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void TLSSessionCache::Offer(SSL *ssl, const ConnectionKey & key)
+    {
+      SSL_set_ex_data(ssl, KeyIndex(), const_cast<ConnectionKey *>(&key));
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _sessions.find(key);
+      if (it != _sessions.end()) {
+        if (SSL_SESSION_is_resumable(it->second)) {
+          SSL_set_session(ssl, it->second);
+        }
+        else {
+          SSL_SESSION_free(it->second);
+          _sessions.erase(it);
+        }
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void TLSSessionCache::HandshakeDone(SSL *ssl, bool success)
+    {
+      if (success && SSL_session_reused(ssl)) {
+        ++_hits;
+      }
+      else {
+        ++_misses;
+        if (! success) {
+          const ConnectionKey  *key =
+            static_cast<const ConnectionKey *>(SSL_get_ex_data(ssl,
+                                                               KeyIndex()));
+          if (key) {
+            Forget(*key);
+          }
+        }
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    int TLSSessionCache::NewSessionCallback(SSL *ssl, SSL_SESSION *session)
+    {
+      const ConnectionKey  *key =
+        static_cast<const ConnectionKey *>(SSL_get_ex_data(ssl, KeyIndex()));
+      if (! key) {
+        return 0;  // not ours to keep; OpenSSL will free it.
+      }
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _sessions.find(*key);
+      if (it != _sessions.end()) {
+        SSL_SESSION_free(it->second);
+        it->second = session;
+      }
+      else {
+        _sessions[*key] = session;
+      }
+      return 1;  // we took the reference
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void TLSSessionCache::Forget(const ConnectionKey & key)
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _sessions.find(key);
+      if (it != _sessions.end()) {
+        SSL_SESSION_free(it->second);
+        _sessions.erase(it);
+      }
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void TLSSessionCache::Clear()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      for (auto & session : _sessions) {
+        SSL_SESSION_free(session.second);
+      }
+      _sessions.clear();
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t TLSSessionCache::Size()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _sessions.size();
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
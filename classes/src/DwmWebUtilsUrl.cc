@@ -0,0 +1,297 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2022, 2024, 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrl.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::Url class implementation
+//---------------------------------------------------------------------------
+
+#include <stdexcept>
+
+#include "DwmWebUtilsUrl.hh"
+#include "DwmWebUtilsUrlView.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Lowercases the ASCII letters in @c s.
+    //------------------------------------------------------------------------
+    static void ToLower(std::string & s)
+    {
+      for (auto & c : s) {
+        if ((c >= 'A') && (c <= 'Z')) {
+          c += ('a' - 'A');
+        }
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns the value of hex digit @c c, or -1 if it's not one.
+    //------------------------------------------------------------------------
+    static int HexValue(char c)
+    {
+      if ((c >= '0') && (c <= '9')) {
+        return (c - '0');
+      }
+      else if ((c >= 'A') && (c <= 'F')) {
+        return (c - 'A' + 10);
+      }
+      else if ((c >= 'a') && (c <= 'f')) {
+        return (c - 'a' + 10);
+      }
+      return -1;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns true if @c c is an unreserved character (RFC 3986 section
+    //!  2.3), which never needs to be percent-encoded.
+    //------------------------------------------------------------------------
+    static bool IsUnreserved(char c)
+    {
+      return (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'))
+              || ((c >= '0') && (c <= '9'))
+              || (c == '-') || (c == '.') || (c == '_') || (c == '~'));
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Decodes percent-encoded unreserved characters in @c s and
+    //!  uppercases the hex digits of the rest (RFC 3986 sections 6.2.2.1
+    //!  and 6.2.2.2).
+    //------------------------------------------------------------------------
+    static void NormalizePercents(std::string & s)
+    {
+      if (s.find('%') == std::string::npos) {
+        return;
+      }
+      static const char  hexDigits[] = "0123456789ABCDEF";
+      size_t  out = 0;
+      for (size_t i = 0; i < s.size(); ) {
+        int  hi, lo;
+        if ((s[i] == '%') && ((i + 2) < s.size())
+            && ((hi = HexValue(s[i+1])) >= 0)
+            && ((lo = HexValue(s[i+2])) >= 0)) {
+          char  c = (hi << 4) | lo;
+          if (IsUnreserved(c)) {
+            s[out++] = c;
+          }
+          else {
+            s[out++] = '%';
+            s[out++] = hexDigits[hi];
+            s[out++] = hexDigits[lo];
+          }
+          i += 3;
+        }
+        else {
+          s[out++] = s[i++];
+        }
+      }
+      s.resize(out);
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Removes "." and ".." segments from @c path, per the algorithm in
+    //!  RFC 3986 section 5.2.4.
+    //------------------------------------------------------------------------
+    static void RemoveDotSegments(std::string & path)
+    {
+      if (path.find('.') == std::string::npos) {
+        return;
+      }
+      auto  popSegment = [] (std::string & out) {
+        auto  slash = out.rfind('/');
+        out.resize((slash == std::string::npos) ? 0 : slash);
+      };
+      std::string       out;
+      std::string_view  in(path);
+      out.reserve(path.size());
+      while (! in.empty()) {
+        if (in.starts_with("../")) {
+          in.remove_prefix(3);
+        }
+        else if (in.starts_with("./") || in.starts_with("/./")) {
+          in.remove_prefix(2);
+        }
+        else if (in == "/.") {
+          in = "/";
+        }
+        else if (in.starts_with("/../")) {
+          in.remove_prefix(3);
+          popSegment(out);
+        }
+        else if (in == "/..") {
+          in = "/";
+          popSegment(out);
+        }
+        else if ((in == ".") || (in == "..")) {
+          in = std::string_view();
+        }
+        else {
+          size_t  end = in.find('/', 1);
+          if (end == std::string_view::npos) {
+            end = in.size();
+          }
+          out.append(in.substr(0, end));
+          in.remove_prefix(end);
+        }
+      }
+      path = std::move(out);
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Url::Url(const std::string & url)
+    {
+      if (! Parse(url)) {
+        throw std::invalid_argument("Invalid URL");
+      }
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Url::Url(const UrlView & urlView)
+    {
+      *this = urlView;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    Url & Url::operator = (const UrlView & urlView)
+    {
+      _scheme.assign(urlView.Scheme());
+      _userinfo.assign(urlView.UserInfo());
+      _host.assign(urlView.Host());
+      _port = urlView.Port();
+      _path.assign(urlView.Path());
+      _query.assign(urlView.Query());
+      _fragment.assign(urlView.Fragment());
+      return *this;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Url::Parse(std::string_view url)
+    {
+      UrlView  urlView;
+      bool  rc = urlView.Parse(url);
+      *this = urlView;
+      return rc;
+    }
+  
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void Url::Clear()
+    {
+      _scheme.clear();
+      _userinfo.clear();
+      _host.clear();
+      _port = 0;
+      _path.clear();
+      _query.clear();
+      _fragment.clear();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::string Url::AfterAuthority() const
+    {
+      return UrlView(*this).AfterAuthority();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::string Url::to_string(bool elideDefaultPort) const
+    {
+      return UrlView(*this).to_string(elideDefaultPort);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t Url::Hash() const
+    {
+      return UrlView(*this).Hash();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void Url::Normalize()
+    {
+      ToLower(_scheme);
+      if (_host.find(':') == std::string::npos) {
+        NormalizePercents(_host);
+      }
+      ToLower(_host);
+      NormalizePercents(_userinfo);
+      NormalizePercents(_path);
+      RemoveDotSegments(_path);
+      if (_path.empty()) {
+        _path.assign(1, '/');
+      }
+      NormalizePercents(_query);
+      NormalizePercents(_fragment);
+      return;
+    }
+      
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool Url::operator == (const Url & url) const
+    {
+      return ((_scheme == url._scheme)
+              && (_userinfo == url._userinfo)
+              && (_host == url._host)
+              && (_port == url._port)
+              && (_path == url._path)
+              && (_query == url._query)
+              && (_fragment == url._fragment));
+    }
+
+  }  // namespace WebUtils
+  
+}  // namespace Dwm
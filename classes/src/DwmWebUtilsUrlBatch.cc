@@ -0,0 +1,367 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrlBatch.cc
+//!  \author Daniel W. McRobb
+//!  \brief Bulk URL validation implementation
+//---------------------------------------------------------------------------
+
+extern "C" {
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+}
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#include "DwmSysLogger.hh"
+#include "DwmWebUtilsUrlBatch.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  We don't start a thread for fewer URLs (or bytes of newline-
+    //!  delimited URLs) than this; below it the thread startup costs more
+    //!  than it saves.
+    //------------------------------------------------------------------------
+    static constexpr size_t  k_minUrlsPerThread = 16384;
+    static constexpr size_t  k_minBytesPerThread = 1024 * 1024;
+    
+    //------------------------------------------------------------------------
+    //!  Returns the location of @c component in @c url, or {0,0} if it's
+    //!  empty or isn't in @c url (the default path of a UrlView).
+    //------------------------------------------------------------------------
+    static UrlOffsets::Range RangeIn(std::string_view url,
+                                     std::string_view component)
+    {
+      std::less_equal<const char *>  le;
+      if ((! component.empty())
+          && le(url.data(), component.data())
+          && le(component.data() + component.size(),
+                url.data() + url.size())) {
+        return UrlOffsets::Range(component.data() - url.data(),
+                                 component.size());
+      }
+      return UrlOffsets::Range(0, 0);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void UrlOffsets::Set(size_t start, std::string_view url,
+                         const UrlView & urlView, bool valid)
+    {
+      _start = start;
+      _length = url.size();
+      _port = urlView.Port();
+      _valid = valid;
+      _scheme = RangeIn(url, urlView.Scheme());
+      _userinfo = RangeIn(url, urlView.UserInfo());
+      _host = RangeIn(url, urlView.Host());
+      _path = RangeIn(url, urlView.Path());
+      _query = RangeIn(url, urlView.Query());
+      _fragment = RangeIn(url, urlView.Fragment());
+      return;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    UrlView UrlOffsets::View(std::string_view input) const
+    {
+      std::string_view  url = input.substr(_start, _length);
+      auto  get = [&url] (const Range & range) {
+        return url.substr(range.first, range.second);
+      };
+      UrlView  rc;
+      rc.Scheme(get(_scheme));
+      rc.UserInfo(get(_userinfo));
+      rc.Host(get(_host));
+      rc.Port(_port);
+      rc.Path(_path.second ? get(_path) : std::string_view("/"));
+      rc.Query(get(_query));
+      rc.Fragment(get(_fragment));
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Validates @c url, which starts at @c start in the input.  Returns
+    //!  true if it's valid.
+    //------------------------------------------------------------------------
+    static bool ParseOne(size_t start, std::string_view url,
+                         UrlOffsets & offsets)
+    {
+      UrlView  urlView;
+      bool  rc = ((url.size() <= UINT32_MAX) && urlView.Parse(url));
+      offsets.Set(start, url, urlView, rc);
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns the number of threads to use for @c work units of work
+    //!  when each thread should get at least @c minWork of it.
+    //------------------------------------------------------------------------
+    static size_t NumThreads(size_t work, size_t minWork,
+                             unsigned int maxThreads)
+    {
+      size_t  rc = maxThreads;
+      if (0 == rc) {
+        rc = std::max(std::thread::hardware_concurrency(), 1U);
+      }
+      return std::max(std::min(rc, work / minWork), (size_t)1);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Calls @c fn(i) for each i in [0, @c threads), in parallel.  The
+    //!  calling thread does i == 0.
+    //------------------------------------------------------------------------
+    template <typename Fn>
+    static void RunInParallel(size_t threads, const Fn & fn)
+    {
+      std::vector<std::thread>  workers;
+      workers.reserve(threads - 1);
+      for (size_t i = 1; i < threads; ++i) {
+        workers.emplace_back([&fn, i] { fn(i); });
+      }
+      fn(0);
+      for (auto & worker : workers) {
+        worker.join();
+      }
+      return;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static size_t Sum(const std::vector<size_t> & v)
+    {
+      size_t  rc = 0;
+      for (auto n : v) {
+        rc += n;
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    template <typename StringType>
+    static size_t ParseArray(std::span<const StringType> urls,
+                             std::vector<UrlOffsets> & results,
+                             unsigned int maxThreads)
+    {
+      results.resize(urls.size());
+      size_t  threads = NumThreads(urls.size(), k_minUrlsPerThread,
+                                   maxThreads);
+      size_t  perThread = (urls.size() + threads - 1) / threads;
+      std::vector<size_t>  valid(threads, 0);
+      RunInParallel(threads, [&] (size_t t) {
+        size_t  end = std::min(urls.size(), (t + 1) * perThread);
+        for (size_t i = t * perThread; i < end; ++i) {
+          valid[t] += ParseOne(0, urls[i], results[i]);
+        }
+      });
+      return Sum(valid);
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ParseUrls(std::span<const std::string_view> urls,
+                     std::vector<UrlOffsets> & results,
+                     unsigned int maxThreads)
+    {
+      return ParseArray(urls, results, maxThreads);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t ParseUrls(std::span<const std::string> urls,
+                     std::vector<UrlOffsets> & results,
+                     unsigned int maxThreads)
+    {
+      return ParseArray(urls, results, maxThreads);
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns the number of lines in @c lines.
+    //------------------------------------------------------------------------
+    static size_t CountLines(std::string_view lines)
+    {
+      size_t  rc = std::count(lines.begin(), lines.end(), '\n');
+      if ((! lines.empty()) && (lines.back() != '\n')) {
+        ++rc;
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Validates each line of @c chunk, which starts at offset @c start
+    //!  in the input, storing the results starting at @c results.
+    //!  Lines are found with memchr(), which libc vectorizes.  Returns
+    //!  the number of valid URLs.
+    //------------------------------------------------------------------------
+    static size_t ParseChunk(size_t start, std::string_view chunk,
+                             UrlOffsets *results)
+    {
+      size_t       rc = 0;
+      const char  *p = chunk.data();
+      const char  *end = p + chunk.size();
+      while (p < end) {
+        const char  *nl = (const char *)memchr(p, '\n', end - p);
+        const char  *eol = nl ? nl : end;
+        std::string_view  line(p, eol - p);
+        if ((! line.empty()) && (line.back() == '\r')) {
+          line.remove_suffix(1);
+        }
+        rc += ParseOne(start + (p - chunk.data()), line, *results++);
+        p = eol + 1;
+      }
+      return rc;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  Splits @c lines into one chunk per thread at line boundaries.
+    //!  Each thread counts the lines in its chunk so we can size
+    //!  @c results once and give each thread its own part of it, then
+    //!  each thread splits and validates its chunk in a single pass.
+    //------------------------------------------------------------------------
+    size_t ParseUrlLines(std::string_view lines,
+                         std::vector<UrlOffsets> & results,
+                         unsigned int maxThreads)
+    {
+      size_t  threads = NumThreads(lines.size(), k_minBytesPerThread,
+                                   maxThreads);
+      std::vector<size_t>  bounds(threads + 1, lines.size());
+      bounds[0] = 0;
+      for (size_t t = 1; t < threads; ++t) {
+        size_t  pos = std::max(bounds[t-1], (lines.size() / threads) * t);
+        pos = lines.find('\n', pos);
+        bounds[t] = (pos == std::string_view::npos) ? lines.size() : pos + 1;
+      }
+      auto  chunk = [&] (size_t t) {
+        return lines.substr(bounds[t], bounds[t+1] - bounds[t]);
+      };
+      
+      std::vector<size_t>  counts(threads, 0);
+      RunInParallel(threads, [&] (size_t t) {
+        counts[t] = CountLines(chunk(t));
+      });
+      std::vector<size_t>  firsts(threads, 0);
+      for (size_t t = 1; t < threads; ++t) {
+        firsts[t] = firsts[t-1] + counts[t-1];
+      }
+      results.resize(Sum(counts));
+      
+      std::vector<size_t>  valid(threads, 0);
+      RunInParallel(threads, [&] (size_t t) {
+        valid[t] = ParseChunk(bounds[t], chunk(t), results.data() + firsts[t]);
+      });
+      return Sum(valid);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    MappedFile::~MappedFile()
+    {
+      Close();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool MappedFile::Open(const std::string & path)
+    {
+      Close();
+      int  fd = open(path.c_str(), O_RDONLY);
+      if (fd < 0) {
+        Syslog(LOG_ERR, "Failed to open %s: %s", path.c_str(),
+               strerror(errno));
+        return false;
+      }
+      bool         rc = false;
+      struct stat  st;
+      if (fstat(fd, &st) == 0) {
+        if (st.st_size == 0) {
+          rc = true;
+        }
+        else {
+          void  *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE,
+                             fd, 0);
+          if (addr != MAP_FAILED) {
+            posix_madvise(addr, st.st_size, POSIX_MADV_SEQUENTIAL);
+            _data = (const char *)addr;
+            _size = st.st_size;
+            rc = true;
+          }
+          else {
+            Syslog(LOG_ERR, "Failed to mmap %s: %s", path.c_str(),
+                   strerror(errno));
+          }
+        }
+      }
+      else {
+        Syslog(LOG_ERR, "Failed to stat %s: %s", path.c_str(),
+               strerror(errno));
+      }
+      close(fd);
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void MappedFile::Close()
+    {
+      if (_data) {
+        munmap((void *)_data, _size);
+        _data = nullptr;
+        _size = 0;
+      }
+      return;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
@@ -0,0 +1,124 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrlTable.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::UrlTable class implementation
+//---------------------------------------------------------------------------
+
+#include <stdexcept>
+
+#include "DwmWebUtilsUrlTable.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  The keys of _ids are views of the Urls in _urls, which a deque
+    //!  never moves, so each URL is stored once.
+    //------------------------------------------------------------------------
+    UrlTable::Id UrlTable::Intern(Url url)
+    {
+      url.Normalize();
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _ids.find(UrlView(url));
+      if (it != _ids.end()) {
+        return it->second;
+      }
+      if (_urls.size() >= k_noId) {
+        return k_noId;
+      }
+      Id  id = _urls.size();
+      _urls.push_back(std::move(url));
+      _ids.emplace(UrlView(_urls.back()), id);
+      return id;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    UrlTable::Id UrlTable::Intern(std::string_view url)
+    {
+      Url  parsed;
+      if (! parsed.Parse(url)) {
+        return k_noId;
+      }
+      return Intern(std::move(parsed));
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    UrlTable::Id UrlTable::Find(Url url) const
+    {
+      url.Normalize();
+      std::lock_guard<std::mutex>  lck(_mtx);
+      auto  it = _ids.find(UrlView(url));
+      return ((it != _ids.end()) ? it->second : k_noId);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    const Url & UrlTable::Get(Id id) const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _urls.at(id);
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    size_t UrlTable::Size() const
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      return _urls.size();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void UrlTable::Clear()
+    {
+      std::lock_guard<std::mutex>  lck(_mtx);
+      _ids.clear();
+      _urls.clear();
+      return;
+    }
+    
+  }  // namespace WebUtils
+
+}  // namespace Dwm
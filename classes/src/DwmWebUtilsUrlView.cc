@@ -0,0 +1,568 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file DwmWebUtilsUrlView.cc
+//!  \author Daniel W. McRobb
+//!  \brief Dwm::WebUtils::UrlView class implementation
+//---------------------------------------------------------------------------
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <boost/asio.hpp>
+
+#include "DwmWebUtilsUrlView.hh"
+
+namespace Dwm {
+
+  namespace WebUtils {
+
+    //------------------------------------------------------------------------
+    //!  Character classes, one bit each.  These are the productions from
+    //!  RFC 3986/3987 that UrlView::Parse() needs.
+    //------------------------------------------------------------------------
+    enum : uint8_t {
+      k_ccAlpha    = 0x01,
+      k_ccDigit    = 0x02,
+      k_ccHex      = 0x04,
+      k_ccScheme   = 0x08,  // ALPHA / DIGIT / "+" / "-" / "."
+      k_ccRegName  = 0x10,  // unreserved / sub-delims
+      k_ccUserInfo = 0x20,  // unreserved / sub-delims / ":"
+      k_ccPath     = 0x40,  // pchar / "/"
+      k_ccQuery    = 0x80   // pchar / "/" / "?"  (also fragment)
+    };
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static constexpr std::array<uint8_t,256> CharClasses()
+    {
+      std::array<uint8_t,256>  rc{};
+      auto  add = [&rc] (const char *chars, uint8_t cls) {
+        for (const char *p = chars; *p; ++p) {
+          rc[(uint8_t)*p] |= cls;
+        }
+      };
+      for (int c = 'a'; c <= 'z'; ++c) {
+        rc[c] |= k_ccAlpha;
+        rc[c - 'a' + 'A'] |= k_ccAlpha;
+      }
+      for (int c = '0'; c <= '9'; ++c) {
+        rc[c] |= k_ccDigit | k_ccHex;
+      }
+      add("abcdefABCDEF", k_ccHex);
+      for (int c = 0; c < 256; ++c) {
+        if (rc[c] & (k_ccAlpha | k_ccDigit)) {
+          rc[c] |= (k_ccScheme | k_ccRegName | k_ccUserInfo | k_ccPath
+                    | k_ccQuery);
+        }
+      }
+      add("+-.", k_ccScheme);
+      const uint8_t  pchar = k_ccRegName | k_ccUserInfo | k_ccPath
+        | k_ccQuery;
+      add("-._~", pchar);            // unreserved
+      add("!$&'()*+,;=", pchar);     // sub-delims
+      add(":", k_ccUserInfo | k_ccPath | k_ccQuery);
+      add("@", k_ccPath | k_ccQuery);
+      add("/", k_ccPath | k_ccQuery);
+      add("?", k_ccQuery);
+      return rc;
+    }
+
+    static constexpr std::array<uint8_t,256>  k_charClasses = CharClasses();
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    static inline bool Is(char c, uint8_t cls)
+    {
+      return (k_charClasses[(uint8_t)c] & cls);
+    }
+    
+#if defined(__GNUC__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define DWM_URL_SPANBLOCK 1
+    
+    //------------------------------------------------------------------------
+    //!  16 bytes in a vector register (SSE2 on x86, NEON on ARM).  We use
+    //!  the compiler's generic vector extensions rather than intrinsics so
+    //!  the same code builds everywhere we do.  SpanBlock() reads the
+    //!  compare mask as two little-endian words, so big-endian targets
+    //!  use the scalar loop in Span() instead.
+    //------------------------------------------------------------------------
+    typedef uint8_t  Bytes16 __attribute__((vector_size(16)));
+
+    //------------------------------------------------------------------------
+    //!  Returns the number of leading bytes of the 16 at @c p that are in
+    //!  the path class (or the query class if @c query is true).  This is
+    //!  the same set as k_ccPath (or k_ccQuery) in k_charClasses, written
+    //!  as byte ranges:  !  $&'()*+,-./0-9:;  =  ?  @A-Z  _  a-z  ~
+    //!  with '%' left out so the caller can check the octet after it.
+    //------------------------------------------------------------------------
+    static inline size_t SpanBlock(const char *p, bool query)
+    {
+      Bytes16  c;
+      memcpy(&c, p, sizeof(c));
+      auto  in = ((c >= '$') & (c <= ';') & (c != '%'))
+        | (c == '!') | (c == '=') | ((c >= '@') & (c <= 'Z')) | (c == '_')
+        | ((c >= 'a') & (c <= 'z')) | (c == '~');
+      if (query) {
+        in |= (c == '?');
+      }
+      uint64_t  w[2];
+      memcpy(w, &in, sizeof(w));
+      if (~w[0]) {
+        return (__builtin_ctzll(~w[0]) >> 3);
+      }
+      if (~w[1]) {
+        return (8 + (__builtin_ctzll(~w[1]) >> 3));
+      }
+      return 16;
+    }
+#endif
+
+    //------------------------------------------------------------------------
+    //!  Returns the position of the first character at or after @c pos in
+    //!  @c s that is neither in @c cls nor part of a percent-encoded
+    //!  octet.  Paths and queries, which are most of the bytes in most
+    //!  URLs, are checked 16 bytes at a time where we can.
+    //------------------------------------------------------------------------
+    static size_t Span(std::string_view s, size_t pos, uint8_t cls)
+    {
+      while (pos < s.size()) {
+#if defined(DWM_URL_SPANBLOCK)
+        if (((cls == k_ccPath) || (cls == k_ccQuery))
+            && ((pos + 16) <= s.size())) {
+          size_t  n = SpanBlock(s.data() + pos, (cls == k_ccQuery));
+          pos += n;
+          if (n == 16) {
+            continue;
+          }
+        }
+#endif
+        if (Is(s[pos], cls)) {
+          ++pos;
+        }
+        else if ((s[pos] == '%') && ((pos + 2) < s.size())
+                 && Is(s[pos+1], k_ccHex) && Is(s[pos+2], k_ccHex)) {
+          pos += 3;
+        }
+        else {
+          break;
+        }
+      }
+      return pos;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns true if @c host contains an ASCII letter.
+    //------------------------------------------------------------------------
+    static bool HasAlpha(std::string_view host)
+    {
+      for (char c : host) {
+        if (Is(c, k_ccAlpha)) {
+          return true;
+        }
+      }
+      return false;
+    }
+  
+    //------------------------------------------------------------------------
+    //!  Returns true if @c host contains "--" or "-.", or ends with "-".
+    //------------------------------------------------------------------------
+    static bool HasIllegalHyphens(std::string_view host)
+    {
+      for (size_t i = 0; i < host.size(); ++i) {
+        if (host[i] == '-') {
+          if (((i + 1) == host.size())
+              || (host[i+1] == '-') || (host[i+1] == '.')) {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    //------------------------------------------------------------------------
+    //!  Parses @c s as a dotted-quad IPv4 address, as strictly as
+    //!  inet_pton() (exactly 4 octets, no leading zeros).  Returns true
+    //!  on success.
+    //------------------------------------------------------------------------
+    static bool ParseIPv4(std::string_view s, uint8_t (&octets)[4])
+    {
+      size_t  pos = 0;
+      for (int i = 0; i < 4; ++i) {
+        if (i > 0) {
+          if ((pos >= s.size()) || (s[pos] != '.')) {
+            return false;
+          }
+          ++pos;
+        }
+        size_t    start = pos;
+        unsigned  val = 0;
+        while ((pos < s.size()) && Is(s[pos], k_ccDigit)
+               && ((pos - start) < 3)) {
+          val = (val * 10) + (s[pos] - '0');
+          ++pos;
+        }
+        if ((pos == start) || (val > 255)
+            || ((s[start] == '0') && ((pos - start) > 1))) {
+          return false;
+        }
+        octets[i] = val;
+      }
+      return (pos == s.size());
+    }
+
+    //------------------------------------------------------------------------
+    //!  Returns true if @c host is usable: a registered name with at least
+    //!  one letter and no misplaced hyphens, or an IPv4 or IPv6 (if
+    //!  @c bracketed) address that's neither unspecified nor multicast.
+    //------------------------------------------------------------------------
+    static bool ValidHost(std::string_view host, bool bracketed)
+    {
+      if (bracketed) {
+        //  Parse already made sure it's only hex digits, ':' and '.'.
+        char  buf[64];
+        if (host.size() >= sizeof(buf)) {
+          return false;
+        }
+        host.copy(buf, host.size());
+        buf[host.size()] = '\0';
+        boost::system::error_code  ec;
+        auto  addr = boost::asio::ip::make_address_v6(buf, ec);
+        return ((! ec) && (! addr.is_unspecified())
+                && (! addr.is_multicast()));
+      }
+      if (HasAlpha(host)) {
+        return (! HasIllegalHyphens(host));
+      }
+      uint8_t  octets[4];
+      if (ParseIPv4(host, octets)) {
+        bool  isZero = ((octets[0] | octets[1] | octets[2] | octets[3]) == 0);
+        bool  isMulticast = ((octets[0] & 0xF0) == 0xE0);
+        return ((! isZero) && (! isMulticast));
+      }
+      return false;
+    }
+    
+    //------------------------------------------------------------------------
+    //!  The components found by ParseComponents(), as slices of its input.
+    //------------------------------------------------------------------------
+    struct UrlComponents
+    {
+      std::string_view  scheme;
+      std::string_view  userinfo;
+      std::string_view  host;
+      std::string_view  path;
+      std::string_view  query;
+      std::string_view  fragment;
+      uint16_t          port = 0;
+      bool              bracketed = false;
+    };
+    
+    //------------------------------------------------------------------------
+    //!  Splits @c s into components in a single pass, checking the
+    //!  characters of each.  The grammar is the one our flex scanner
+    //!  used to accept:
+    //!
+    //!    scheme "://" [userinfo "@"] host [":" [port]] [path]
+    //!      ["?" query] ["#" fragment]
+    //!
+    //!  where host is a registered name (starting with a letter or digit)
+    //!  or a bracketed IPv6 address, and path (if present) starts with
+    //!  "/".  Returns false if @c s doesn't match.  The host is not
+    //!  checked beyond its characters; see ValidHost().
+    //------------------------------------------------------------------------
+    static bool ParseComponents(std::string_view s, UrlComponents & c)
+    {
+      //  scheme
+      if (s.empty() || (! Is(s[0], k_ccAlpha))) {
+        return false;
+      }
+      size_t  pos = 1;
+      while ((pos < s.size()) && Is(s[pos], k_ccScheme)) {
+        ++pos;
+      }
+      c.scheme = s.substr(0, pos);
+      if (s.compare(pos, 3, "://") != 0) {
+        return false;
+      }
+      pos += 3;
+
+      //  [userinfo "@"]
+      size_t  end = Span(s, pos, k_ccUserInfo);
+      if ((end < s.size()) && (s[end] == '@')) {
+        c.userinfo = s.substr(pos, end - pos);
+        pos = end + 1;
+      }
+
+      //  host
+      if ((pos < s.size()) && (s[pos] == '[')) {
+        end = s.find(']', pos + 1);
+        if ((end == std::string_view::npos) || (end == (pos + 1))) {
+          return false;
+        }
+        for (size_t i = pos + 1; i < end; ++i) {
+          if (! (Is(s[i], k_ccHex) || (s[i] == ':') || (s[i] == '.'))) {
+            return false;
+          }
+        }
+        c.host = s.substr(pos + 1, end - (pos + 1));
+        c.bracketed = true;
+        pos = end + 1;
+      }
+      else if ((pos < s.size()) && Is(s[pos], k_ccAlpha | k_ccDigit)) {
+        end = Span(s, pos + 1, k_ccRegName);
+        c.host = s.substr(pos, end - pos);
+        pos = end;
+      }
+
+      //  [":" [port]]
+      if ((pos < s.size()) && (s[pos] == ':')) {
+        ++pos;
+        uint32_t  port = 0;
+        size_t    start = pos;
+        while ((pos < s.size()) && Is(s[pos], k_ccDigit)) {
+          port = (port * 10) + (s[pos] - '0');
+          if (((pos - start) >= 5) || (port > 65535)) {
+            return false;
+          }
+          ++pos;
+        }
+        c.port = port;
+      }
+      if (pos == s.size()) {
+        return true;
+      }
+
+      //  [path]
+      if (s[pos] != '/') {
+        return false;
+      }
+      end = Span(s, pos, k_ccPath);
+      c.path = s.substr(pos, end - pos);
+      pos = end;
+
+      //  ["?" query]
+      if ((pos < s.size()) && (s[pos] == '?')) {
+        end = Span(s, pos + 1, k_ccQuery);
+        c.query = s.substr(pos + 1, end - (pos + 1));
+        pos = end;
+      }
+      
+      //  ["#" fragment]
+      if ((pos < s.size()) && (s[pos] == '#')) {
+        end = Span(s, pos + 1, k_ccQuery);
+        c.fragment = s.substr(pos + 1, end - (pos + 1));
+        pos = end;
+      }
+      return (pos == s.size());
+    }
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    UrlView::UrlView(std::string_view url)
+    {
+      if (! Parse(url)) {
+        throw std::invalid_argument("Invalid URL");
+      }
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    UrlView::UrlView(const Url & url)
+        : _scheme(url.Scheme()), _userinfo(url.UserInfo()),
+          _host(url.Host()), _port(url.Port()), _path(url.Path()),
+          _query(url.Query()), _fragment(url.Fragment())
+    {}
+    
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    uint16_t UrlView::DefaultPort(std::string_view scheme)
+    {
+      //  Schemes are case-insensitive (RFC 3986 section 3.1).
+      auto  is = [scheme] (std::string_view lower) {
+        if (scheme.size() != lower.size()) {
+          return false;
+        }
+        for (size_t i = 0; i < lower.size(); ++i) {
+          if ((scheme[i] | 0x20) != lower[i]) {
+            return false;
+          }
+        }
+        return true;
+      };
+      if (is("https")) {
+        return 443;
+      }
+      else if (is("http")) {
+        return 80;
+      }
+      else if (is("ftp")) {
+        return 21;
+      }
+      return 0;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool UrlView::Parse(std::string_view url)
+    {
+      UrlComponents  c;
+      bool  parsed = ParseComponents(url, c);
+      _scheme = c.scheme;
+      _userinfo = c.userinfo;
+      _host = c.host;
+      _port = c.port ? c.port : DefaultPort(c.scheme);
+      _path = c.path.empty() ? std::string_view("/") : c.path;
+      _query = c.query;
+      _fragment = c.fragment;
+      
+      bool  rc = false;
+      if (parsed) {
+        if (0 != _port) {
+          rc = ((! c.host.empty()) && ValidHost(c.host, c.bracketed));
+        }
+        else if (c.scheme == "file") {
+          rc = true;
+        }
+      }
+      return rc;
+    }
+  
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    void UrlView::Clear()
+    {
+      *this = UrlView();
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::string UrlView::AfterAuthority() const
+    {
+      std::string  rc;
+      rc.reserve(_path.size() + _query.size() + _fragment.size() + 2);
+      rc += _path;
+      if (! _query.empty()) {
+        rc += '?';
+        rc += _query;
+      }
+      if (! _fragment.empty()) {
+        rc += '#';
+        rc += _fragment;
+      }
+      return rc;
+    }
+
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    std::string UrlView::to_string(bool elideDefaultPort) const
+    {
+      std::string  rc;
+      rc.reserve(_scheme.size() + _userinfo.size() + _host.size()
+                 + _path.size() + _query.size() + _fragment.size() + 16);
+      rc += _scheme;
+      rc += "://";
+      if (! _userinfo.empty()) {
+        rc += _userinfo;
+        rc += '@';
+      }
+      if (! _host.empty()) {
+        //  Only an IPv6 address can have a ':' in it.
+        if (_host.find(':') != std::string_view::npos) {
+          rc += '[';
+          rc += _host;
+          rc += ']';
+        }
+        else {
+          rc += _host;
+        }
+        if (! (elideDefaultPort && (_port == DefaultPort(_scheme)))) {
+          rc += ':';
+          rc += std::to_string(_port);
+        }
+      }
+      rc += _path;
+      if (! _query.empty()) {
+        rc += '?';
+        rc += _query;
+      }
+      if (! _fragment.empty()) {
+        rc += '#';
+        rc += _fragment;
+      }
+      return rc;
+    }
+      
+    //------------------------------------------------------------------------
+    //!  Combines the hashes of the components the way boost::hash_combine
+    //!  does.
+    //------------------------------------------------------------------------
+    size_t UrlView::Hash() const
+    {
+      std::hash<std::string_view>  hash;
+      size_t  rc = _port;
+      for (std::string_view s : { _scheme, _userinfo, _host, _path,
+                                  _query, _fragment }) {
+        rc ^= hash(s) + 0x9e3779b97f4a7c15ULL + (rc << 6) + (rc >> 2);
+      }
+      return rc;
+    }
+      
+    //------------------------------------------------------------------------
+    //!  
+    //------------------------------------------------------------------------
+    bool UrlView::operator == (const UrlView & urlView) const
+    {
+      return ((_scheme == urlView._scheme)
+              && (_userinfo == urlView._userinfo)
+              && (_host == urlView._host)
+              && (_port == urlView._port)
+              && (_path == urlView._path)
+              && (_query == urlView._query)
+              && (_fragment == urlView._fragment));
+    }
+
+  }  // namespace WebUtils
+  
+}  // namespace Dwm
@@ -0,0 +1,166 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file BenchFastJson.cc
+//!  \author Daniel W. McRobb
+//!  \brief Compares nlohmann::json and FastJson parsing speed
+//---------------------------------------------------------------------------
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+#include "DwmWebUtilsFastJson.hh"
+#include "DwmWebUtilsJsonProjection.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+//----------------------------------------------------------------------------
+//!  Returns a document shaped like a weather.gov observation.
+//----------------------------------------------------------------------------
+static string Observation()
+{
+  nlohmann::json  json;
+  json["id"] = "https://api.weather.gov/stations/KPTK/observations/latest";
+  json["type"] = "Feature";
+  json["geometry"] = { {"type", "Point"},
+                       {"coordinates", {-83.42, 42.67}} };
+  nlohmann::json  & props = json["properties"];
+  props["station"] = "https://api.weather.gov/stations/KPTK";
+  props["timestamp"] = "2026-10-16T23:53:00+00:00";
+  props["textDescription"] = "Mostly Cloudy";
+  for (const char *name : {"temperature", "dewpoint", "windDirection",
+                           "windSpeed", "windGust", "barometricPressure",
+                           "seaLevelPressure", "visibility",
+                           "relativeHumidity", "windChill", "heatIndex"}) {
+    props[name] = { {"unitCode", "wmoUnit:degC"}, {"value", 12.8},
+                    {"qualityControl", "V"} };
+  }
+  for (int i = 0; i < 3; ++i) {
+    props["cloudLayers"].push_back({ {"base", { {"unitCode", "wmoUnit:m"},
+                                                {"value", 1000 * i} }},
+                                     {"amount", "BKN"} });
+  }
+  return json.dump();
+}
+
+//----------------------------------------------------------------------------
+//!  Returns a large array of records, like a paged API listing.
+//----------------------------------------------------------------------------
+static string Listing(int records)
+{
+  nlohmann::json  json;
+  json["count"] = records;
+  for (int i = 0; i < records; ++i) {
+    json["items"].push_back({ {"id", i}, {"name", "item-" + to_string(i)},
+                              {"active", (i % 3) != 0},
+                              {"score", i * 0.25},
+                              {"tags", {"alpha", "beta", "gamma"}} });
+  }
+  return json.dump();
+}
+
+//----------------------------------------------------------------------------
+//!  Runs @c fn @c iterations times over @c doc and prints the rate.
+//----------------------------------------------------------------------------
+static void Time(const string & name, const string & doc, int iterations,
+                 const function<bool()> & fn)
+{
+  auto  start = chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    if (! fn()) {
+      cerr << name << " failed\n";
+      return;
+    }
+  }
+  chrono::duration<double>  secs = chrono::steady_clock::now() - start;
+  cout << "  " << left << setw(34) << name << right << setw(10)
+       << fixed << setprecision(1)
+       << ((doc.size() * (double)iterations) / secs.count() / 1e6)
+       << " MB/s" << setw(12) << setprecision(2)
+       << (secs.count() * 1e6 / iterations) << " us/doc\n";
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void Bench(const string & label, const string & doc, int iterations,
+                  const vector<string> & pointers)
+{
+  cout << label << " (" << doc.size() << " bytes, "
+       << (FastJson::HaveSimdJson() ? "simdjson" : "no simdjson")
+       << ")\n";
+  Time("nlohmann::json::parse", doc, iterations, [&] () {
+    nlohmann::json  json = nlohmann::json::parse(doc, nullptr, false);
+    return (! json.is_discarded());
+  });
+  Time("JsonProjection (SAX)", doc, iterations, [&] () {
+    JsonProjection  projection(pointers);
+    return nlohmann::json::sax_parse(doc, &projection);
+  });
+  FastJson  fast;
+  Time("FastJson Parse + Get", doc, iterations, [&] () {
+    if (! fast.Parse(doc)) {
+      return false;
+    }
+    nlohmann::json  value;
+    for (const auto & pointer : pointers) {
+      if (! fast.Get(pointer, value)) {
+        return false;
+      }
+    }
+    return true;
+  });
+  Time("FastJson Parse + ToJson", doc, iterations, [&] () {
+    nlohmann::json  json;
+    return (fast.Parse(doc) && fast.ToJson(json));
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  Bench("observation", Observation(), 20000,
+        {"/properties/temperature/value", "/properties/dewpoint/value",
+         "/properties/textDescription"});
+  Bench("listing", Listing(20000), 20, {"/count", "/items/19999/name"});
+  return 0;
+}
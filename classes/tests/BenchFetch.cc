@@ -0,0 +1,234 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file BenchFetch.cc
+//!  \author Daniel W. McRobb
+//!  \brief Fetch benchmarks against an in-process loopback server
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "DwmWebUtils.hh"
+#include "LoopbackServer.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+static thread_local size_t  t_numNews = 0;
+
+//----------------------------------------------------------------------------
+//!  Counts allocations, per thread.
+//----------------------------------------------------------------------------
+void *operator new(size_t size)
+{
+  ++t_numNews;
+  void  *p = malloc(size ? size : 1);
+  if (! p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+[[gnu::noinline]] void operator delete(void *p) noexcept
+{
+  free(p);
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+[[gnu::noinline]] void operator delete(void *p, size_t) noexcept
+{
+  free(p);
+}
+
+//----------------------------------------------------------------------------
+//!  What we're fetching with.
+//----------------------------------------------------------------------------
+enum class Op { Status, Response, Json };
+
+//----------------------------------------------------------------------------
+//!  Issues one request with @c op.  Returns true on success.
+//----------------------------------------------------------------------------
+static bool Fetch(Op op, const string & url, ConnectionPool & pool,
+                  const RequestOptions & options)
+{
+  GetFailure  failure;
+  switch (op) {
+    case Op::Status:
+      return (GetStatus(url, failure, pool, options, false) == 200);
+    case Op::Response:
+      {
+        http::response<http::string_body>  response;
+        return (GetResponse(url, response, failure, pool, options, false)
+                && (response.result() == http::status::ok));
+      }
+    case Op::Json:
+      {
+        nlohmann::json  json;
+        return GetJson(url, json, failure, pool, options, false);
+      }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+//!  Runs @c op against @c url from @c concurrency threads for about
+//!  @c seconds, after a short warmup, and prints a line of results.
+//----------------------------------------------------------------------------
+static void Bench(Op op, const string & label, const string & url,
+                  size_t size, int concurrency, double seconds)
+{
+  ConnectionPool  pool;
+  RequestOptions  options;
+  for (int i = 0; i < concurrency; ++i) {
+    Fetch(op, url, pool, options);
+  }
+
+  using Clock = chrono::steady_clock;
+  vector<vector<chrono::nanoseconds>>  latencies(concurrency);
+  std::atomic<size_t>  failures(0);
+  std::atomic<size_t>  allocations(0);
+  auto   deadline = Clock::now() + chrono::duration<double>(seconds);
+  auto    start = Clock::now();
+  vector<thread>  threads;
+  for (int t = 0; t < concurrency; ++t) {
+    threads.emplace_back([&, t] {
+      latencies[t].reserve(100000);
+      size_t  numNews = 0;
+      Clock::time_point  now = Clock::now();
+      while (now < deadline) {
+        size_t  before = t_numNews;
+        bool    ok = Fetch(op, url, pool, options);
+        numNews += t_numNews - before;
+        Clock::time_point  end = Clock::now();
+        if (ok) {
+          latencies[t].push_back(end - now);
+        }
+        else {
+          ++failures;
+        }
+        now = end;
+      }
+      allocations += numNews;
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  chrono::duration<double>  elapsed = Clock::now() - start;
+
+  vector<chrono::nanoseconds>  all;
+  for (const auto & l : latencies) {
+    all.insert(all.end(), l.begin(), l.end());
+  }
+  if (all.empty()) {
+    cerr << label << " failed\n";
+    return;
+  }
+  sort(all.begin(), all.end());
+  auto  pct = [&all] (double p) {
+    return (all[min(all.size() - 1, (size_t)(p * all.size()))].count()
+            / 1000.0);
+  };
+  //  Allocations are counted around each fetch on the thread making it,
+  //  so thread startup and latency vector growth aren't included.
+  size_t  requests = all.size() + failures;
+  cout << "  " << left << setw(12) << label << right << setw(8) << size
+       << setw(5) << concurrency
+       << setw(10) << fixed << setprecision(0)
+       << (requests / elapsed.count())
+       << setw(10) << setprecision(1) << pct(0.50)
+       << setw(10) << pct(0.99)
+       << setw(10) << ((double)allocations / requests);
+  if (failures) {
+    cout << "  (" << failures << " failed)";
+  }
+  cout << '\n';
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  double  seconds = 1.0;
+  if (argc > 1) {
+    seconds = atof(argv[1]);
+  }
+  vector<size_t>  sizes = { 128, 16384, 262144 };
+  vector<int>     concurrencies = { 1, 8 };
+  
+  LoopbackServer  server;
+  server.Prepare(sizes);
+  
+  const pair<Op,string>  ops[] = {
+    { Op::Status, "GetStatus" },
+    { Op::Response, "GetResponse" },
+    { Op::Json, "GetJson" }
+  };
+  for (const char *scheme : { "http", "https" }) {
+    uint16_t  port = (string(scheme) == "http")
+      ? server.HttpPort() : server.HttpsPort();
+    cout << scheme << " (keep-alive ConnectionPool, " << seconds
+         << "s per row)\n"
+         << "  " << left << setw(12) << "function" << right << setw(8)
+         << "bytes" << setw(5) << "conc" << setw(10) << "req/s"
+         << setw(10) << "p50 us" << setw(10) << "p99 us"
+         << setw(10) << "allocs" << '\n';
+    for (const auto & op : ops) {
+      for (auto size : sizes) {
+        string  url = string(scheme) + "://127.0.0.1:" + to_string(port)
+          + "/bytes/" + to_string(size);
+        for (auto concurrency : concurrencies) {
+          Bench(op.first, op.second, url, size, concurrency, seconds);
+        }
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,258 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file LoopbackServer.hh
+//!  \author Daniel W. McRobb
+//!  \brief In-process loopback HTTP and HTTPS server for tests and
+//!  benchmarks
+//---------------------------------------------------------------------------
+
+#ifndef _LOOPBACKSERVER_HH_
+#define _LOOPBACKSERVER_HH_
+
+#include <openssl/evp.h>
+#include <openssl/ec.h>
+#include <openssl/x509.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/ssl.hpp>
+
+#include "DwmWebUtils.hh"
+
+namespace asio = boost::asio;
+namespace ssl = boost::asio::ssl;
+using tcp = boost::asio::ip::tcp;
+namespace http = boost::beast::http;
+
+//----------------------------------------------------------------------------
+//!  Gives @c ctx a fresh P-256 key and a self-signed certificate for
+//!  localhost, good for a day.  Returns true on success.
+//----------------------------------------------------------------------------
+inline bool UseSelfSignedCert(ssl::context & ctx)
+{
+  bool           rc = false;
+  EVP_PKEY      *pkey = nullptr;
+  EVP_PKEY_CTX  *pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+  if (pctx && (EVP_PKEY_keygen_init(pctx) > 0)
+      && (EVP_PKEY_CTX_set_ec_paramgen_curve_nid(pctx,
+                                                 NID_X9_62_prime256v1) > 0)
+      && (EVP_PKEY_keygen(pctx, &pkey) > 0)) {
+    X509  *cert = X509_new();
+    X509_set_version(cert, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+    X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+    X509_gmtime_adj(X509_getm_notAfter(cert), 86400);
+    X509_set_pubkey(cert, pkey);
+    X509_NAME  *name = X509_get_subject_name(cert);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                               (const unsigned char *)"localhost", -1, -1, 0);
+    X509_set_issuer_name(cert, name);
+    rc = ((X509_sign(cert, pkey, EVP_sha256()) > 0)
+          && (SSL_CTX_use_certificate(ctx.native_handle(), cert) == 1)
+          && (SSL_CTX_use_PrivateKey(ctx.native_handle(), pkey) == 1));
+    X509_free(cert);
+    EVP_PKEY_free(pkey);
+  }
+  EVP_PKEY_CTX_free(pctx);
+  return rc;
+}
+
+//----------------------------------------------------------------------------
+//!  An HTTP and HTTPS server on loopback, run by its own threads.  GET
+//!  /bytes/N returns a JSON document of about N bytes.  Connections are
+//!  kept alive unless the client asks otherwise.
+//----------------------------------------------------------------------------
+class LoopbackServer
+{
+public:
+  LoopbackServer()
+      : _sslContext(ssl::context::tls_server),
+        _httpAcceptor(_ioc, tcp::endpoint(asio::ip::address_v4::loopback(),
+                                          0)),
+        _httpsAcceptor(_ioc, tcp::endpoint(asio::ip::address_v4::loopback(),
+                                           0))
+  {
+    if (! UseSelfSignedCert(_sslContext)) {
+      std::cerr << "Failed to make a self-signed certificate\n";
+      std::exit(1);
+    }
+    asio::co_spawn(_ioc, Accept(_httpAcceptor, false), asio::detached);
+    asio::co_spawn(_ioc, Accept(_httpsAcceptor, true), asio::detached);
+    unsigned int  numThreads =
+      std::max(std::thread::hardware_concurrency(), 2U);
+    for (unsigned int i = 0; i < numThreads; ++i) {
+      _threads.emplace_back([this]
+                            { t_onServerThread = true; _ioc.run(); });
+    }
+  }
+
+  ~LoopbackServer()
+  {
+    _ioc.stop();
+    for (auto & thread : _threads) {
+      thread.join();
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  //!  Returns true if called from one of the server's threads, so an
+  //!  allocation counter can leave the server's allocations out.
+  //--------------------------------------------------------------------------
+  static bool OnServerThread()
+  { return t_onServerThread; }
+  
+  uint16_t HttpPort() const
+  { return _httpAcceptor.local_endpoint().port(); }
+
+  uint16_t HttpsPort() const
+  { return _httpsAcceptor.local_endpoint().port(); }
+
+  //--------------------------------------------------------------------------
+  //!  Makes the bodies for @c sizes ahead of time, so the server spends
+  //!  its time on I/O rather than building responses.
+  //--------------------------------------------------------------------------
+  void Prepare(const std::vector<size_t> & sizes)
+  {
+    for (auto size : sizes) {
+      std::string  body("{\"size\":" + std::to_string(size)
+                        + ",\"data\":\"");
+      body.append(size > (body.size() + 2) ? size - (body.size() + 2) : 0,
+                  'x');
+      body += "\"}";
+      _bodies[size] = std::move(body);
+    }
+    return;
+  }
+  
+private:
+  static inline thread_local bool  t_onServerThread = false;
+  
+  asio::io_context              _ioc;
+  ssl::context                  _sslContext;
+  tcp::acceptor                 _httpAcceptor;
+  tcp::acceptor                 _httpsAcceptor;
+  std::vector<std::thread>      _threads;
+  std::map<size_t,std::string>  _bodies;
+
+  asio::awaitable<void> Accept(tcp::acceptor & acceptor, bool tls)
+  {
+    for (;;) {
+      boost::system::error_code  ec;
+      tcp::socket  socket =
+        co_await acceptor.async_accept(asio::redirect_error(asio::use_awaitable,
+                                                            ec));
+      if (ec) {
+        co_return;
+      }
+      socket.set_option(tcp::no_delay(true));
+      if (tls) {
+        asio::co_spawn(acceptor.get_executor(),
+                       ServeTls(std::move(socket)), asio::detached);
+      }
+      else {
+        asio::co_spawn(acceptor.get_executor(),
+                       Serve(std::move(socket)), asio::detached);
+      }
+    }
+  }
+
+  asio::awaitable<void> ServeTls(tcp::socket socket)
+  {
+    ssl::stream<tcp::socket>  stream(std::move(socket), _sslContext);
+    boost::system::error_code  ec;
+    co_await stream.async_handshake(ssl::stream_base::server,
+                                    asio::redirect_error(asio::use_awaitable,
+                                                         ec));
+    if (! ec) {
+      co_await Session(stream);
+    }
+    co_return;
+  }
+
+  asio::awaitable<void> Serve(tcp::socket socket)
+  {
+    co_await Session(socket);
+    co_return;
+  }
+  
+  template <typename Stream>
+  asio::awaitable<void> Session(Stream & stream)
+  {
+    boost::beast::flat_buffer  buffer;
+    for (;;) {
+      boost::system::error_code  ec;
+      http::request<http::empty_body>  request;
+      co_await http::async_read(stream, buffer, request,
+                                asio::redirect_error(asio::use_awaitable,
+                                                     ec));
+      if (ec) {
+        co_return;
+      }
+      http::response<http::string_body>  response;
+      response.version(request.version());
+      response.keep_alive(request.keep_alive());
+      auto  target = request.target();
+      auto  it = _bodies.end();
+      if (target.starts_with("/bytes/")) {
+        it = _bodies.find(strtoul(std::string(target.substr(7)).c_str(),
+                                  nullptr, 10));
+      }
+      if (it != _bodies.end()) {
+        response.result(http::status::ok);
+        response.set(http::field::content_type, "application/json");
+        response.body() = it->second;
+      }
+      else {
+        response.result(http::status::not_found);
+      }
+      response.prepare_payload();
+      co_await http::async_write(stream, response,
+                                 asio::redirect_error(asio::use_awaitable,
+                                                      ec));
+      if (ec || (! request.keep_alive())) {
+        co_return;
+      }
+    }
+  }
+};
+
+#endif  // _LOOPBACKSERVER_HH_
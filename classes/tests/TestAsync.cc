@@ -0,0 +1,103 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestAsync.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils asynchronous functions
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtilsAsync.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+namespace asio = boost::asio;
+
+static const string  g_urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static asio::awaitable<void> TestAwaitable(asio::io_context & ioc)
+{
+  auto  [getFail, json] =
+    co_await AsyncGetJson(ioc, g_urlstr, asio::use_awaitable);
+  if (UnitAssert(! getFail)) {
+    UnitAssert(json.is_object());
+  }
+  auto  [statusFail, status] =
+    co_await AsyncGetStatus(ioc, "ftp://foo.bar/baz", asio::use_awaitable);
+  UnitAssert(statusFail.FailNum() == GetFailure::k_failNumURL);
+  UnitAssert(status == -1);
+  co_return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  asio::io_context  ioc;
+  
+  int  numDone = 0;
+  for (int i = 0; i < 4; ++i) {
+    AsyncGetStatus(ioc, g_urlstr,
+                   [&numDone] (GetFailure getFail, int status)
+                   {
+                     UnitAssert(! getFail);
+                     UnitAssert(status == 200);
+                     ++numDone;
+                   });
+  }
+  asio::co_spawn(ioc, TestAwaitable(ioc), asio::detached);
+  ioc.run();
+  UnitAssert(numDone == 4);
+
+  ioc.restart();
+  auto  fut = AsyncGetResponse(ioc, g_urlstr, asio::use_future);
+  ioc.run();
+  auto  [getFail, response] = fut.get();
+  UnitAssert(! getFail);
+  UnitAssert(response.result_int() == 200);
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,90 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestBatch.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::GetStatusMany and
+//!  Dwm::WebUtils::GetJsonMany
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtilsBatch.hh"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  using namespace   Dwm::WebUtils;
+  vector<string>  urls = {
+    "https://api.weather.gov/stations/KPTK/observations/latest",
+    "https://api.weather.gov/stations/KDTW/observations/latest",
+    "https://api.weather.gov/stations/KARB/observations/latest",
+    "https://api.weather.gov/stations/KYIP/observations/latest",
+    "not a URL"
+  };
+  BatchOptions  options;
+  options.MaxPerHost(2);
+  
+  auto  statuses = GetStatusMany(urls, options);
+  if (UnitAssert(statuses.size() == urls.size())) {
+    for (size_t i = 0; i < 4; ++i) {
+      UnitAssert(! statuses[i].first);
+      UnitAssert(statuses[i].second == 200);
+    }
+    UnitAssert(statuses[4].first.FailNum() == GetFailure::k_failNumURL);
+    UnitAssert(statuses[4].second == -1);
+  }
+
+  auto  jsons = GetJsonMany(urls, options);
+  if (UnitAssert(jsons.size() == urls.size())) {
+    for (size_t i = 0; i < 4; ++i) {
+      UnitAssert(! jsons[i].first);
+      UnitAssert(jsons[i].second.is_object());
+    }
+    UnitAssert(jsons[4].first.FailNum() == GetFailure::k_failNumURL);
+  }
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,88 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestConnectionPool.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::ConnectionPool
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  using namespace   Dwm::WebUtils;
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  ConnectionPool  pool(2);
+  GetFailure      getFail;
+  
+  for (int i = 0; i < 3; ++i) {
+    nlohmann::json  json;
+    if (UnitAssert(GetJson(urlstr, json, getFail, pool))) {
+      UnitAssert(! getFail);
+      UnitAssert(json.is_object());
+      UnitAssert(pool.IdleConnections() == 1);
+    }
+  }
+
+  UnitAssert(GetStatus(urlstr, getFail, pool) == 200);
+  UnitAssert(pool.IdleConnections() == 1);
+
+  ConnectionKey  key(Url(urlstr), true);
+  auto  conn1 = pool.Checkout(key);
+  UnitAssert(conn1->IsOpen());
+  auto  conn2 = pool.Checkout(key);
+  UnitAssert(! conn2->IsOpen());
+  pool.Return(std::move(conn2));
+  pool.Return(std::move(conn1));
+  UnitAssert(pool.IdleConnections() == 1);
+
+  pool.Clear();
+  UnitAssert(pool.IdleConnections() == 0);
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,202 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestContentDecoder.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::ContentDecoder
+//---------------------------------------------------------------------------
+
+#include <zlib.h>
+#include <cstring>
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+#include "DwmWebUtilsContentDecoder.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+//----------------------------------------------------------------------------
+//!  Compresses @c s with zlib.  @c windowBits selects the wrapper: 15 + 16
+//!  for gzip, 15 for zlib, -15 for raw deflate.
+//----------------------------------------------------------------------------
+static string Compress(const string & s, int windowBits)
+{
+  z_stream  zs;
+  memset(&zs, 0, sizeof(zs));
+  deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, windowBits, 8,
+               Z_DEFAULT_STRATEGY);
+  string  rc(deflateBound(&zs, s.size()), '\0');
+  zs.next_in = (Bytef *)s.data();
+  zs.avail_in = s.size();
+  zs.next_out = (Bytef *)rc.data();
+  zs.avail_out = rc.size();
+  deflate(&zs, Z_FINISH);
+  rc.resize(zs.total_out);
+  deflateEnd(&zs);
+  return rc;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static string MakeContent()
+{
+  nlohmann::json  json;
+  for (int i = 0; i < 20000; ++i) {
+    json["data"].push_back({{"i", i}, {"s", "some repetitive text"}});
+  }
+  return json.dump();
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestZlib()
+{
+  string  content = MakeContent();
+  string  decoded;
+  
+  UnitAssert(ContentDecoder::Decode("gzip", Compress(content, 15 + 16),
+                                    decoded));
+  UnitAssert(decoded == content);
+  UnitAssert(ContentDecoder::Decode("Deflate", Compress(content, 15),
+                                    decoded));
+  UnitAssert(decoded == content);
+  UnitAssert(ContentDecoder::Decode(" deflate ", Compress(content, -15),
+                                    decoded));
+  UnitAssert(decoded == content);
+
+  //  Concatenated gzip members.
+  string  half1 = content.substr(0, content.size() / 2);
+  string  half2 = content.substr(content.size() / 2);
+  UnitAssert(ContentDecoder::Decode("gzip",
+                                    Compress(half1, 15 + 16)
+                                    + Compress(half2, 15 + 16),
+                                    decoded));
+  UnitAssert(decoded == content);
+  
+  //  Fed a byte at a time; output never exceeds k_outputSize per call.
+  string  gz = Compress(content, 15 + 16);
+  ContentDecoder  decoder;
+  UnitAssert(decoder.Begin("gzip"));
+  decoded.clear();
+  bool  bounded = true;
+  auto  append = [&] (string_view s) {
+    bounded = bounded && (s.size() <= ContentDecoder::k_outputSize);
+    decoded.append(s);
+    return true;
+  };
+  for (char c : gz) {
+    if (! decoder.Decode(string_view(&c, 1), append)) {
+      break;
+    }
+  }
+  UnitAssert(decoder.End());
+  UnitAssert(decoded == content);
+  UnitAssert(bounded);
+
+  //  Truncated and corrupt content.
+  UnitAssert(! ContentDecoder::Decode("gzip", gz.substr(0, gz.size() / 2),
+                                      decoded));
+  UnitAssert(! ContentDecoder::Decode("gzip", content, decoded));
+
+  //  Nothing to do, or nothing we can do.
+  UnitAssert(! decoder.Begin(""));
+  UnitAssert(! decoder.Begin("identity"));
+  UnitAssert(! decoder.Begin("gzip, compress"));
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestBrotli()
+{
+  string  accept = ContentDecoder::AcceptEncoding();
+  if (! ContentDecoder::HaveBrotli()) {
+    UnitAssert(accept.find("br") == string::npos);
+    return;
+  }
+  UnitAssert(accept.find("br") != string::npos);
+  static const unsigned char  br[] = {
+    0x8b, 0x0e, 0x80, 0x7b, 0x22, 0x68, 0x65, 0x6c, 0x6c, 0x6f,
+    0x22, 0x3a, 0x22, 0x62, 0x72, 0x6f, 0x74, 0x6c, 0x69, 0x22,
+    0x2c, 0x22, 0x6e, 0x22, 0x3a, 0x5b, 0x31, 0x2c, 0x32, 0x2c,
+    0x33, 0x5d, 0x7d, 0x03
+  };
+  string  decoded;
+  UnitAssert(ContentDecoder::Decode("br", string((const char *)br,
+                                                 sizeof(br)), decoded));
+  UnitAssert(decoded == "{\"hello\":\"brotli\",\"n\":[1,2,3]}");
+  UnitAssert(! ContentDecoder::Decode("br", string((const char *)br,
+                                                   sizeof(br) - 1),
+                                      decoded));
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGetJson()
+{
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  nlohmann::json  json1, json2;
+  GetFailure      getFail;
+  RequestOptions  options;
+  UnitAssert(GetJson(urlstr, json1, getFail, options));
+  options.Compression(false);
+  UnitAssert(GetJson(urlstr, json2, getFail, options));
+  UnitAssert(json1["properties"]["station"] == json2["properties"]["station"]);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestZlib();
+  TestBrotli();
+  TestGetJson();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,149 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file TestFastJson.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::FastJson
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+#include "DwmWebUtilsFastJson.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+static const string  g_doc = R"({
+  "id": "abc",
+  "properties": {
+    "temperature": { "unitCode": "wmoUnit:degC", "value": 21.5 },
+    "dewpoint": { "unitCode": "wmoUnit:degC", "value": null },
+    "elevation": -12,
+    "count": 18446744073709551615,
+    "ok": true,
+    "clouds": [ { "base": 100, "amount": "FEW" },
+                { "base": 2000, "amount": "BKN" } ],
+    "a/b": "slash"
+  }
+})";
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGet()
+{
+  FastJson  json;
+  if (! UnitAssert(json.Parse(g_doc))) {
+    return;
+  }
+  string    s;
+  double    d;
+  int64_t   i;
+  uint64_t  u;
+  bool      b;
+  UnitAssert(json.Get("/id", s) && (s == "abc"));
+  UnitAssert(json.Get("/properties/temperature/value", d) && (d == 21.5));
+  UnitAssert(json.Get("/properties/elevation", i) && (i == -12));
+  UnitAssert(json.Get("/properties/count", u)
+             && (u == 18446744073709551615ULL));
+  UnitAssert(! json.Get("/properties/count", i));
+  UnitAssert(! json.Get("/properties/elevation", u));
+  UnitAssert(json.Get("/properties/ok", b) && b);
+  UnitAssert(json.Get("/properties/clouds/1/amount", s) && (s == "BKN"));
+  UnitAssert(json.Get("/properties/a~1b", s) && (s == "slash"));
+  UnitAssert(! json.Get("/properties/temperature/unitCode", d));
+  UnitAssert(! json.Get("/nope", s));
+  UnitAssert(! json.Get("/properties/clouds/2/base", i));
+  //  Lookups can be done in any order.
+  UnitAssert(json.Get("/id", s) && (s == "abc"));
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestToJson()
+{
+  nlohmann::json  full = nlohmann::json::parse(g_doc);
+  FastJson        json;
+  nlohmann::json  converted;
+  if (UnitAssert(json.Parse(g_doc))) {
+    UnitAssert(json.ToJson(converted));
+    UnitAssert(converted == full);
+    UnitAssert(json.Get("/properties/clouds", converted));
+    UnitAssert(converted == full["properties"]["clouds"]);
+    UnitAssert(json.Get("/properties/dewpoint/value", converted));
+    UnitAssert(converted.is_null());
+  }
+  UnitAssert(! json.Parse("{\"id\": \"abc"));
+  UnitAssert(! json.Get("/id", converted));
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGetJson()
+{
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  FastJson    json;
+  GetFailure  getFailure;
+  if (UnitAssert(GetJson(urlstr, json, getFailure))) {
+    UnitAssert(! getFailure);
+    string  id;
+    UnitAssert(json.Get("/id", id));
+    nlohmann::json  converted;
+    UnitAssert(json.Get("/properties", converted));
+    UnitAssert(converted.is_object());
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestGet();
+  TestToJson();
+  TestGetJson();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+}
@@ -49,6 +49,53 @@
 
 using namespace std;
 
+//----------------------------------------------------------------------------
+//!  SAX handler that counts the top-level keys and notes whether there's
+//!  a "properties" object.
+//----------------------------------------------------------------------------
+class TopLevelKeys
+  : public nlohmann::json_sax<nlohmann::json>
+{
+public:
+  size_t  keys = 0;
+  bool    sawProperties = false;
+  
+  bool null() override                                 { return true; }
+  bool boolean(bool) override                          { return true; }
+  bool number_integer(number_integer_t) override       { return true; }
+  bool number_unsigned(number_unsigned_t) override     { return true; }
+  bool number_float(number_float_t, const string_t &) override
+  { return true; }
+  bool string(string_t &) override                     { return true; }
+  bool binary(binary_t &) override                     { return true; }
+  bool start_object(std::size_t) override
+  {
+    if ((_depth == 1) && _lastKey == "properties") {
+      sawProperties = true;
+    }
+    ++_depth;
+    return true;
+  }
+  bool end_object() override                           { --_depth; return true; }
+  bool start_array(std::size_t) override               { ++_depth; return true; }
+  bool end_array() override                            { --_depth; return true; }
+  bool key(string_t & val) override
+  {
+    if (_depth == 1) {
+      ++keys;
+      _lastKey = val;
+    }
+    return true;
+  }
+  bool parse_error(std::size_t, const std::string &,
+                   const nlohmann::detail::exception &) override
+  { return false; }
+
+private:
+  int          _depth = 0;
+  std::string  _lastKey;
+};
+
 //----------------------------------------------------------------------------
 //!  
 //----------------------------------------------------------------------------
@@ -65,6 +112,20 @@ int main(int argc, char *argv[])
     }
   }
 
+  GetFailure      getFailure;
+  ConnectionPool  pool;
+  if (UnitAssert(GetJson(urlstr, json, getFailure, pool))) {
+    UnitAssert(! getFailure);
+    UnitAssert(json.is_object());
+  }
+  
+  TopLevelKeys  sax;
+  if (UnitAssert(GetJson(urlstr, sax, getFailure))) {
+    UnitAssert(! getFailure);
+    UnitAssert(sax.keys == json.size());
+    UnitAssert(sax.sawProperties);
+  }
+
   if (Dwm::Assertions::Total().Failed())
     Dwm::Assertions::Print(cerr, true);
   else
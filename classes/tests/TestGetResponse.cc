@@ -41,6 +41,7 @@
 
 #include <cassert>
 #include <chrono>
+#include <filesystem>
 #include <iostream>
 #include <thread>
 
@@ -100,6 +101,45 @@ int main(int argc, char *argv[])
   if (UnitAssert(GetResponse(urlstr, response, getFail))) {
     UnitAssert(! getFail);
   }
+
+  http::response_header<>  header;
+  string  body;
+  auto  appendChunk = [&] (std::string_view chunk) {
+    UnitAssert(header.result() == http::status::ok);
+    body.append(chunk);
+    return true;
+  };
+  if (UnitAssert(GetStream(urlstr, header, appendChunk, getFail))) {
+    UnitAssert(! getFail);
+    nlohmann::json  json = nlohmann::json::parse(body, nullptr, false);
+    UnitAssert(! json.is_discarded());
+  }
+  UnitAssert(! GetStream(urlstr, header,
+                         [] (std::string_view) { return false; }, getFail));
+  UnitAssert(getFail.FailNum() == GetFailure::k_failNumGet);
+
+  string          path("./TestGetResponse.out");
+  TransferStats   stats;
+  if (UnitAssert(GetToFile(urlstr, path, stats, getFail))) {
+    UnitAssert(! getFail);
+    UnitAssert(stats.Bytes() > 0);
+    UnitAssert(stats.ResumedAt() == 0);
+    UnitAssert(std::filesystem::file_size(path) == stats.Bytes());
+  }
+  std::filesystem::remove(path);
+  
+  RequestOptions  options;
+  options.TotalTimeout(std::chrono::milliseconds(1));
+  UnitAssert(! GetResponse(urlstr, response, getFail, options));
+  UnitAssert(getFail.FailNum() == GetFailure::k_failNumTimeout);
+  UnitAssert(getFail.FailType() == GetFailure::e_failTypeTimeout);
+  UnitAssert(getFail.to_string() == "TIMEOUT");
+
+  options = RequestOptions();
+  options.IdleReadTimeout(std::chrono::milliseconds(10000));
+  if (UnitAssert(GetResponse(urlstr, response, getFail, options))) {
+    UnitAssert(! getFail);
+  }
   
   if (Dwm::Assertions::Total().Failed())
     Dwm::Assertions::Print(cerr, true);
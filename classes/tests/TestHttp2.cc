@@ -0,0 +1,123 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestHttp2.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for HTTP/2 requests via Dwm::WebUtils::ConnectionPool
+//---------------------------------------------------------------------------
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+static const string  g_urlstr =
+  "https://api.weather.gov/stations/KPTK/observations/latest";
+
+//----------------------------------------------------------------------------
+//!  Concurrent requests should all share one HTTP/2 session.
+//----------------------------------------------------------------------------
+static void TestConcurrent()
+{
+  ConnectionPool  pool(4);
+  RequestOptions  options;
+  options.Http2(true);
+  
+  vector<thread>  threads;
+  vector<int>     results(8, 0);
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&, i] () {
+      GetFailure      getFail;
+      nlohmann::json  json;
+      if (i % 2) {
+        results[i] = GetStatus(g_urlstr, getFail, pool, options);
+      }
+      else if (GetJson(g_urlstr, json, getFail, pool, options)
+               && json.is_object()) {
+        results[i] = 200;
+      }
+    });
+  }
+  for (auto & t : threads) {
+    t.join();
+  }
+  for (auto result : results) {
+    UnitAssert(result == 200);
+  }
+  if (Http2Session::Supported()) {
+    UnitAssert(pool.Http2Sessions() == 1);
+    UnitAssert(pool.IdleConnections() == 0);
+  }
+  else {
+    UnitAssert(pool.Http2Sessions() == 0);
+  }
+  pool.Clear();
+  UnitAssert(pool.Http2Sessions() == 0);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  Without RequestOptions::Http2(), the pool sticks to HTTP/1.1.
+//----------------------------------------------------------------------------
+static void TestOptIn()
+{
+  ConnectionPool  pool(2);
+  GetFailure      getFail;
+  UnitAssert(GetStatus(g_urlstr, getFail, pool, RequestOptions()) == 200);
+  UnitAssert(pool.Http2Sessions() == 0);
+  UnitAssert(pool.IdleConnections() == 1);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestConcurrent();
+  TestOptIn();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
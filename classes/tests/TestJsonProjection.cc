@@ -0,0 +1,165 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file TestJsonProjection.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::JsonProjection
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+#include "DwmWebUtilsJsonProjection.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+using Pointer = nlohmann::json::json_pointer;
+
+static const string  g_doc = R"({
+  "id": "abc",
+  "properties": {
+    "temperature": { "unitCode": "wmoUnit:degC", "value": 21.5 },
+    "dewpoint": { "unitCode": "wmoUnit:degC", "value": null },
+    "clouds": [ { "base": 100, "amount": "FEW" },
+                { "base": 2000, "amount": "BKN" } ],
+    "a/b": 1,
+    "m~n": 2
+  },
+  "big": [ [1, 2, 3], { "x": [4, 5] }, "skipped" ]
+})";
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static nlohmann::json Project(const vector<string> & pointers)
+{
+  JsonProjection  projection(pointers);
+  UnitAssert(nlohmann::json::sax_parse(g_doc, &projection));
+  return projection.Result();
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestScalars()
+{
+  nlohmann::json  json =
+    Project({"/id", "/properties/temperature/value",
+             "/properties/dewpoint/value"});
+  UnitAssert(json[Pointer("/id")] == "abc");
+  UnitAssert(json[Pointer("/properties/temperature/value")] == 21.5);
+  UnitAssert(json.contains(Pointer("/properties/dewpoint/value")));
+  UnitAssert(json[Pointer("/properties/dewpoint/value")].is_null());
+  UnitAssert(! json.contains(Pointer("/properties/temperature/unitCode")));
+  UnitAssert(! json.contains(Pointer("/big")));
+  UnitAssert(json.size() == 2);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestSubtrees()
+{
+  nlohmann::json  full = nlohmann::json::parse(g_doc);
+  nlohmann::json  json = Project({"/properties/clouds", "/big/1"});
+  UnitAssert(json[Pointer("/properties/clouds")]
+             == full[Pointer("/properties/clouds")]);
+  UnitAssert(json[Pointer("/big/1")] == full[Pointer("/big/1")]);
+  //  Array elements before a selected one are null placeholders.
+  UnitAssert(json[Pointer("/big/0")].is_null());
+  UnitAssert(json["big"].size() == 2);
+
+  json = Project({"/properties/clouds/1/amount", "/big/0/2"});
+  UnitAssert(json[Pointer("/properties/clouds/1/amount")] == "BKN");
+  UnitAssert(json[Pointer("/big/0/2")] == 3);
+
+  json = Project({""});
+  UnitAssert(json == full);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestEscapesAndMisses()
+{
+  nlohmann::json  json = Project({"/properties/a~1b", "/properties/m~0n"});
+  UnitAssert(json[Pointer("/properties/a~1b")] == 1);
+  UnitAssert(json[Pointer("/properties/m~0n")] == 2);
+
+  json = Project({"/nope", "/big/7", "/id/x", "bad", "/bad~2"});
+  UnitAssert(json.is_null());
+
+  JsonProjection  projection({"/id"});
+  UnitAssert(! nlohmann::json::sax_parse(string("{\"id\": "), &projection));
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGetJson()
+{
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  nlohmann::json  json;
+  GetFailure      getFailure;
+  if (UnitAssert(GetJson(urlstr, {"/properties/temperature", "/id"},
+                         json, getFailure))) {
+    UnitAssert(! getFailure);
+    UnitAssert(json.contains(Pointer("/properties/temperature")));
+    UnitAssert(json.contains(Pointer("/id")));
+    UnitAssert(json["properties"].size() == 1);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestScalars();
+  TestSubtrees();
+  TestEscapesAndMisses();
+  TestGetJson();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+}
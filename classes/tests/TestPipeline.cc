@@ -0,0 +1,95 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestPipeline.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::Connection::GetPipelined()
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  using namespace   Dwm::WebUtils;
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  vector<Url>  urls = {
+    Url(urlstr),
+    Url("https://api.weather.gov/stations/KDTW/observations/latest"),
+    Url("https://api.weather.gov/stations/KARB/observations/latest"),
+    Url("https://www.weather.gov/"),   // different host
+    Url(urlstr)
+  };
+  
+  Connection  conn(ConnectionKey(urls[0], true));
+  vector<http::response<http::string_body>>  responses;
+  vector<GetFailure>                         failures;
+  UnitAssert(! conn.GetPipelined(urls, responses, failures, true));
+  if (UnitAssert(responses.size() == urls.size())
+      && UnitAssert(failures.size() == urls.size())) {
+    for (size_t i = 0; i < urls.size(); ++i) {
+      if (i == 3) {
+        UnitAssert(failures[i].FailNum() == GetFailure::k_failNumURL);
+      }
+      else if (UnitAssert(! failures[i])) {
+        UnitAssert(responses[i].result() == http::status::ok);
+        auto  json = nlohmann::json::parse(responses[i].body(), nullptr,
+                                           false);
+        UnitAssert(json.is_object());
+      }
+    }
+  }
+  UnitAssert(conn.Requests() >= 4);
+
+  //  Again on the now-idle connection, without the bad URL.
+  urls.erase(urls.begin() + 3);
+  UnitAssert(conn.GetPipelined(urls, responses, failures, false));
+  UnitAssert(responses.size() == urls.size());
+  UnitAssert(! conn.Reusable());
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,160 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestPmr.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for PmrResponse and PmrJson
+//---------------------------------------------------------------------------
+
+#include <iostream>
+#include <memory_resource>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+
+using namespace std;
+
+//----------------------------------------------------------------------------
+//!  Counts bytes outstanding.
+//----------------------------------------------------------------------------
+class CountingResource
+  : public std::pmr::memory_resource
+{
+public:
+  size_t  outstanding = 0;
+  size_t  allocations = 0;
+
+private:
+  void *do_allocate(size_t bytes, size_t alignment) override
+  {
+    outstanding += bytes;
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override
+  {
+    outstanding -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  
+  bool do_is_equal(const std::pmr::memory_resource & other)
+    const noexcept override
+  { return (this == &other); }
+};
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestPmrJson()
+{
+  using namespace Dwm::WebUtils;
+  
+  CountingResource  counter;
+  PmrJson  json;
+  {
+    Dwm::WebUtils::PmrJsonScope  scope(&counter);
+    json = PmrJson::parse(R"({"stations": ["KPTK", "KDTW"],)"
+                          R"( "properties": {"textDescription":)"
+                          R"( "Mostly cloudy with a chance of rain"}})");
+  }
+  UnitAssert(counter.allocations > 0);
+  UnitAssert(counter.outstanding > 0);
+  UnitAssert(json["stations"].size() == 2);
+  UnitAssert(json["stations"][1] == "KDTW");
+  UnitAssert(json["properties"]["textDescription"]
+             .get_ref<const PmrJson::string_t &>()
+             == "Mostly cloudy with a chance of rain");
+  //  Freed outside the scope, but still back to counter.
+  json = nullptr;
+  UnitAssert(counter.outstanding == 0);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGet()
+{
+  using namespace Dwm::WebUtils;
+
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  CountingResource                     counter;
+  std::pmr::monotonic_buffer_resource  arena(&counter);
+  ConnectionPool                       pool;
+  RequestOptions                       options;
+  GetFailure                           failure;
+  
+  PmrResponse  response = MakePmrResponse(&arena);
+  if (UnitAssert(GetResponse(urlstr, response, failure, pool, options))) {
+    UnitAssert(response.result() == http::status::ok);
+    UnitAssert(! response.body().empty());
+    UnitAssert(response.body().get_allocator().resource() == &arena);
+    UnitAssert(counter.outstanding > 0);
+  }
+
+  PmrJson  json;
+  for (int i = 0; i < 3; ++i) {
+    if (UnitAssert(GetJson(urlstr, json, &arena, failure, pool, options))) {
+      UnitAssert(json.is_object());
+      UnitAssert(json.contains("properties"));
+    }
+  }
+  if (UnitAssert(GetJson(urlstr, json, &arena, failure, options))) {
+    UnitAssert(json.is_object());
+  }
+  //  Done with this cycle.
+  json = nullptr;
+  response = MakePmrResponse(&arena);
+  arena.release();
+  UnitAssert(counter.outstanding == 0);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestPmrJson();
+  TestGet();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
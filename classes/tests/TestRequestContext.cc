@@ -0,0 +1,134 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestRequestContext.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::RequestContext
+//---------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+#include "LoopbackServer.hh"
+
+using namespace std;
+
+static std::atomic<size_t>  g_numNews(0);
+
+//----------------------------------------------------------------------------
+//!  Counts allocations, except on the loopback server's threads.
+//----------------------------------------------------------------------------
+void *operator new(size_t size)
+{
+  if (! LoopbackServer::OnServerThread()) {
+    ++g_numNews;
+  }
+  void  *p = malloc(size ? size : 1);
+  if (! p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+[[gnu::noinline]] void operator delete(void *p) noexcept
+{
+  free(p);
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+[[gnu::noinline]] void operator delete(void *p, size_t) noexcept
+{
+  free(p);
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  using namespace   Dwm::WebUtils;
+
+  //  A loopback server, so nothing outside our control (a server
+  //  closing the connection, a CDN rotating connections) can force a
+  //  reconnect, which allocates.
+  LoopbackServer  server;
+  server.Prepare({ 16384 });
+  
+  ConnectionPool  pool;
+  RequestContext  context;
+  RequestOptions  options;
+  GetFailure      failure;
+  Url  url("https://127.0.0.1:" + to_string(server.HttpsPort())
+           + "/bytes/16384");
+  
+  //  Warm up: connect, and grow the context's storage.
+  for (int i = 0; i < 3; ++i) {
+    if (UnitAssert(pool.Get(url, context, failure, options, false))) {
+      UnitAssert(context.Response().result() == http::status::ok);
+    }
+  }
+  UnitAssert(context.ArenaSize() > 0);
+  
+  //  Steady state: no allocations.  Each request that allocates is a
+  //  failure of the assertion below, so the failure count is the number
+  //  of requests that allocated.
+  for (int i = 0; i < 10; ++i) {
+    size_t  numNews = g_numNews;
+    bool    ok = pool.Get(url, context, failure, options, false);
+    size_t  requestNews = g_numNews - numNews;
+    UnitAssert(requestNews == 0);
+    UnitAssert(ok && (context.Response().result() == http::status::ok)
+               && (! context.Response().body().empty()));
+  }
+  auto  json = nlohmann::json::parse(context.Response().body(), nullptr,
+                                     false);
+  UnitAssert(json.is_object() && (json["size"] == 16384));
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,195 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestRequestMetrics.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::RequestMetrics
+//---------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+static const string  g_urlstr =
+  "https://api.weather.gov/stations/KPTK/observations/latest";
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestPhases()
+{
+  using std::chrono::microseconds;
+  RequestMetrics  metrics;
+  UnitAssert(! metrics.Reached(RequestMetrics::e_start));
+  UnitAssert(metrics.Elapsed() == microseconds(0));
+
+  auto  start = metrics.Mark(RequestMetrics::e_start);
+  metrics.Mark(RequestMetrics::e_requestSent, start + microseconds(10));
+  metrics.Mark(RequestMetrics::e_firstByte, start + microseconds(40));
+  metrics.Mark(RequestMetrics::e_bodyDone, start + microseconds(100));
+  UnitAssert(metrics.Reached(RequestMetrics::e_start));
+  UnitAssert(! metrics.Reached(RequestMetrics::e_dnsDone));
+  UnitAssert(metrics.DnsTime() == microseconds(0));
+  UnitAssert(metrics.TlsTime() == microseconds(0));
+  UnitAssert(metrics.TimeToFirstByte() == microseconds(30));
+  UnitAssert(metrics.TransferTime() == microseconds(60));
+  UnitAssert(metrics.ParseTime() == microseconds(0));
+  UnitAssert(metrics.Elapsed() == microseconds(100));
+  metrics.Mark(RequestMetrics::e_parseDone, start + microseconds(125));
+  UnitAssert(metrics.ParseTime() == microseconds(25));
+  UnitAssert(metrics.Elapsed() == microseconds(125));
+
+  metrics.BytesRead(42);
+  metrics.ConnectionReused(true);
+  metrics.Clear();
+  UnitAssert(! metrics.Reached(RequestMetrics::e_start));
+  UnitAssert(metrics.BytesRead() == 0);
+  UnitAssert(! metrics.ConnectionReused());
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGetJson()
+{
+  ConnectionPool  pool(1);
+  RequestMetrics  metrics;
+  RequestOptions  options;
+  GetFailure      getFail;
+  options.Metrics(&metrics);
+
+  nlohmann::json  json;
+  if (UnitAssert(GetJson(g_urlstr, json, getFail, pool, options))) {
+    //  New connection: every phase happened.
+    UnitAssert(! metrics.ConnectionReused());
+    UnitAssert(metrics.Reached(RequestMetrics::e_dnsDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_connectDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_tlsDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_firstByte));
+    UnitAssert(metrics.Reached(RequestMetrics::e_bodyDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_parseDone));
+    UnitAssert(metrics.TlsTime().count() > 0);
+    UnitAssert(metrics.BytesRead() > 0);
+    UnitAssert(metrics.RemoteEndpoint().port() == 443);
+    UnitAssert(metrics.Elapsed() >= metrics.TimeToFirstByte());
+  }
+
+  if (UnitAssert(GetJson(g_urlstr, json, getFail, pool, options))) {
+    //  Pooled connection: no lookup, connect or handshake.
+    UnitAssert(metrics.ConnectionReused());
+    UnitAssert(! metrics.Reached(RequestMetrics::e_dnsDone));
+    UnitAssert(! metrics.Reached(RequestMetrics::e_connectDone));
+    UnitAssert(! metrics.Reached(RequestMetrics::e_tlsDone));
+    UnitAssert(! metrics.TlsSessionReused());
+    UnitAssert(metrics.Reached(RequestMetrics::e_firstByte));
+    UnitAssert(metrics.Reached(RequestMetrics::e_parseDone));
+    UnitAssert(metrics.BytesRead() > 0);
+    UnitAssert(metrics.RemoteEndpoint().port() == 443);
+  }
+
+  //  A new connection to the same host finds the name in the resolver
+  //  cache and resumes the TLS session.
+  pool.Clear();
+  http::response<http::string_body>  response;
+  if (UnitAssert(GetResponse(g_urlstr, response, getFail, pool, options))) {
+    UnitAssert(! metrics.ConnectionReused());
+    UnitAssert(metrics.DnsCached());
+    UnitAssert(metrics.TlsSessionReused());
+    UnitAssert(metrics.Reached(RequestMetrics::e_bodyDone));
+    UnitAssert(! metrics.Reached(RequestMetrics::e_parseDone));
+  }
+
+  //  Without a pool, each request has its own connection.
+  if (UnitAssert(GetJson(g_urlstr, json, getFail, options))) {
+    UnitAssert(! metrics.ConnectionReused());
+    UnitAssert(metrics.Reached(RequestMetrics::e_connectDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_tlsDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_parseDone));
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestRequestContext()
+{
+  ConnectionPool  pool(1);
+  RequestContext  context;
+  RequestMetrics  metrics;
+  RequestOptions  options;
+  GetFailure      getFail;
+  options.Metrics(&metrics);
+
+  Url  url(g_urlstr);
+  if (UnitAssert(pool.Get(url, context, getFail, options))) {
+    UnitAssert(! metrics.ConnectionReused());
+    UnitAssert(metrics.Reached(RequestMetrics::e_connectDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_requestSent));
+    UnitAssert(metrics.Reached(RequestMetrics::e_firstByte));
+    UnitAssert(metrics.Reached(RequestMetrics::e_bodyDone));
+    UnitAssert(metrics.BytesRead() > 0);
+    UnitAssert(metrics.RemoteEndpoint().port() == 443);
+  }
+  if (UnitAssert(pool.Get(url, context, getFail, options))) {
+    UnitAssert(metrics.ConnectionReused());
+    UnitAssert(! metrics.Reached(RequestMetrics::e_connectDone));
+    UnitAssert(metrics.Reached(RequestMetrics::e_firstByte));
+    UnitAssert(metrics.Reached(RequestMetrics::e_bodyDone));
+    UnitAssert(metrics.BytesRead() > 0);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestPhases();
+  TestGetJson();
+  TestRequestContext();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+}
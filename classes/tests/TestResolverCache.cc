@@ -0,0 +1,138 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestResolverCache.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::ResolverCache
+//---------------------------------------------------------------------------
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+#include "DwmWebUtilsResolverCache.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestPositive()
+{
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  ResolverCache::Clear();
+  uint64_t  hits = ResolverCache::Hits();
+  uint64_t  misses = ResolverCache::Misses();
+  GetFailure  getFail;
+  UnitAssert(GetStatus(urlstr, getFail) == 200);
+  UnitAssert(ResolverCache::Misses() == misses + 1);
+  UnitAssert(ResolverCache::Size() == 1);
+  UnitAssert(GetStatus(urlstr, getFail) == 200);
+  UnitAssert(ResolverCache::Hits() == hits + 1);
+  UnitAssert(ResolverCache::Misses() == misses + 1);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestNegative()
+{
+  string  urlstr("https://no-such-host.invalid/");
+  ResolverCache::Clear();
+  uint64_t  negativeHits = ResolverCache::NegativeHits();
+  GetFailure  getFail;
+  UnitAssert(GetStatus(urlstr, getFail) == -1);
+  UnitAssert(getFail.FailNum() == GetFailure::k_failNumConnect);
+  UnitAssert(ResolverCache::Size() == 1);
+  UnitAssert(GetStatus(urlstr, getFail) == -1);
+  UnitAssert(getFail.FailNum() == GetFailure::k_failNumConnect);
+  UnitAssert(ResolverCache::NegativeHits() == negativeHits + 1);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestRefreshAhead()
+{
+  using namespace std::chrono;
+  
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  ResolverCache::Clear();
+  ResolverCache::PositiveTTL(milliseconds(2000));
+  ResolverCache::RefreshAhead(milliseconds(1500));
+  uint64_t  refreshes = ResolverCache::Refreshes();
+  uint64_t  misses = ResolverCache::Misses();
+  GetFailure  getFail;
+  UnitAssert(GetStatus(urlstr, getFail) == 200);
+  std::this_thread::sleep_for(milliseconds(600));
+  //  Inside the refresh-ahead window: uses the cached entry and starts a
+  //  background refresh.
+  UnitAssert(GetStatus(urlstr, getFail) == 200);
+  UnitAssert(ResolverCache::Refreshes() == refreshes + 1);
+  std::this_thread::sleep_for(milliseconds(1600));
+  //  Past the original expiry, but the refresh replaced the entry.
+  UnitAssert(GetStatus(urlstr, getFail) == 200);
+  UnitAssert(ResolverCache::Misses() == misses + 1);
+
+  ResolverCache::PositiveTTL(milliseconds(0));
+  ResolverCache::Clear();
+  UnitAssert(GetStatus(urlstr, getFail) == 200);
+  UnitAssert(ResolverCache::Size() == 0);
+  ResolverCache::PositiveTTL(milliseconds(60000));
+  ResolverCache::RefreshAhead(milliseconds(10000));
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestPositive();
+  TestNegative();
+  TestRefreshAhead();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
@@ -0,0 +1,213 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+
+//---------------------------------------------------------------------------
+//!  \file TestResponseCache.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::ResponseCache
+//---------------------------------------------------------------------------
+
+#include <filesystem>
+#include <iostream>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtils.hh"
+#include "DwmWebUtilsResponseCache.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static http::response<http::string_body>
+MakeResponse(http::status status, const string & cacheControl,
+             const string & etag, const string & body)
+{
+  http::response<http::string_body>  rsp(status, 11);
+  if (! cacheControl.empty()) {
+    rsp.set(http::field::cache_control, cacheControl);
+  }
+  if (! etag.empty()) {
+    rsp.set(http::field::etag, etag);
+  }
+  rsp.body() = body;
+  rsp.prepare_payload();
+  return rsp;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestRules()
+{
+  ResponseCache  cache;
+  string  key = ResponseCache::Key("http://example.com/a");
+  
+  //  Fresh for 60 seconds.
+  auto  entry = cache.Update(key, MakeResponse(http::status::ok,
+                                               "public, max-age=60",
+                                               "\"v1\"", "one"));
+  UnitAssert(entry != nullptr);
+  UnitAssert(entry->Fresh());
+  UnitAssert(entry->etag == "\"v1\"");
+  UnitAssert(cache.Find(key) == entry);
+  UnitAssert(cache.Stores() == 1);
+
+  //  Validator only: stored, but must be revalidated.
+  entry = cache.Update(key, MakeResponse(http::status::ok, "", "\"v2\"",
+                                         "two"));
+  UnitAssert(entry != nullptr);
+  UnitAssert(! entry->Fresh());
+  UnitAssert(cache.Find(key)->response.body() == "two");
+
+  //  A 304 renews the entry and keeps the body.
+  auto  nm = MakeResponse(http::status::not_modified, "max-age=60", "", "");
+  nm.set(http::field::age, "10");
+  entry = cache.Update(key, nm);
+  UnitAssert(entry != nullptr);
+  UnitAssert(entry->Fresh());
+  UnitAssert(entry->response.body() == "two");
+  UnitAssert(cache.Revalidations() == 1);
+
+  //  Parsed JSON rides along with the entry until it's replaced.
+  nlohmann::json  json;
+  UnitAssert(! cache.FindJson(key, json));
+  cache.StoreJson(key, nlohmann::json({{"x", 1}}));
+  UnitAssert(cache.FindJson(key, json));
+  UnitAssert(json["x"] == 1);
+  
+  //  no-store and uncacheable statuses remove the entry.
+  UnitAssert(! cache.Update(key, MakeResponse(http::status::ok, "no-store",
+                                              "\"v3\"", "three")));
+  UnitAssert(! cache.Find(key));
+  cache.Update(key, MakeResponse(http::status::ok, "max-age=60", "", "x"));
+  UnitAssert(cache.Find(key) != nullptr);
+  UnitAssert(! cache.Update(key, MakeResponse(http::status::not_found,
+                                              "max-age=60", "", "")));
+  UnitAssert(! cache.Find(key));
+
+  //  Nothing to validate with and no max-age: not stored.
+  UnitAssert(! cache.Update(key, MakeResponse(http::status::ok, "", "",
+                                              "four")));
+  //  no-cache: stored, always revalidated.  Age counts against max-age.
+  UnitAssert(! cache.Update(key, MakeResponse(http::status::ok,
+                                              "no-cache, max-age=60",
+                                              "\"v5\"", "five"))->Fresh());
+  auto  aged = MakeResponse(http::status::ok, "max-age=60", "\"v6\"", "six");
+  aged.set(http::field::age, "61");
+  UnitAssert(! cache.Update(key, aged)->Fresh());
+
+  //  Eviction.
+  cache.Clear();
+  cache.MaxEntries(2);
+  for (int i = 0; i < 3; ++i) {
+    cache.Update(ResponseCache::Key("http://example.com/" + to_string(i)),
+                 MakeResponse(http::status::ok, "max-age=60", "", "x"));
+  }
+  UnitAssert(cache.Size() == 2);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestDisk()
+{
+  namespace fs = std::filesystem;
+  fs::path  dir = fs::temp_directory_path() / "TestResponseCache.dir";
+  fs::remove_all(dir);
+  fs::create_directory(dir);
+  string  key = ResponseCache::Key("http://example.com/disk");
+  {
+    ResponseCache  cache(dir.string());
+    cache.Update(key, MakeResponse(http::status::ok, "max-age=60",
+                                   "\"d1\"", "{\"disk\":true}"));
+  }
+  {
+    ResponseCache  cache(dir.string());
+    auto  entry = cache.Find(key);
+    UnitAssert(entry != nullptr);
+    if (entry) {
+      UnitAssert(entry->Fresh());
+      UnitAssert(entry->etag == "\"d1\"");
+      UnitAssert(entry->response.body() == "{\"disk\":true}");
+    }
+    cache.Clear();
+  }
+  {
+    ResponseCache  cache(dir.string());
+    UnitAssert(! cache.Find(key));
+  }
+  fs::remove_all(dir);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestGetJson()
+{
+  string  urlstr("https://api.weather.gov/stations/KPTK/observations/latest");
+  auto  cache = make_shared<ResponseCache>();
+  RequestOptions  options;
+  options.Cache(cache);
+  nlohmann::json  json1, json2;
+  GetFailure      getFail;
+  UnitAssert(GetJson(urlstr, json1, getFail, options));
+  UnitAssert(cache->Stores() == 1);
+  //  Either still fresh or revalidated with a 304; either way, the
+  //  same JSON.
+  UnitAssert(GetJson(urlstr, json2, getFail, options));
+  UnitAssert((cache->Hits() + cache->Revalidations()) == 1);
+  UnitAssert(json1 == json2);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  TestRules();
+  TestDisk();
+  TestGetJson();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
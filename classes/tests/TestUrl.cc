@@ -5,6 +5,7 @@
 
 #include "DwmUnitAssert.hh"
 #include "DwmWebUtilsUrl.hh"
+#include "DwmWebUtilsUrlView.hh"
 
 using namespace std;
 
@@ -75,7 +76,15 @@ static TestData_t goodUrls[] = {
   { "http://a.b-c.de",
     "http", "", "a.b-c.de", 80, "", "", "" },
   { "http://223.255.255.254",
-    "http", "", "223.255.255.254", 80, "", "", "" }
+    "http", "", "223.255.255.254", 80, "", "", "" },
+  { "http://[::1]/",
+    "http", "", "::1", 80, "/", "", "" },
+  { "https://[2001:db8::7]:8443/x?y#z",
+    "https", "", "2001:db8::7", 8443, "/x", "y", "z" },
+  { "http://[::ffff:192.0.2.1]",
+    "http", "", "::ffff:192.0.2.1", 80, "", "", "" },
+  { "http://example.com:65535/",
+    "http", "", "example.com", 65535, "/", "", "" }
 };
 
 static const std::string  badUrls[] = {
@@ -112,12 +121,59 @@ static const std::string  badUrls[] = {
   "http://123.123.123",
   "http://3628126748",
   "http://.www.foo.bar/",
-  "http://.www.foo.bar./"
+  "http://.www.foo.bar./",
+  "http://[::]/",
+  "http://[ff02::1]/",
+  "http://[1::2::3]/",
+  "http://[::1/",
+  "http://[]/",
+  "http://01.1.1.1/",
+  "http://example.com:65536/",
+  "http://example.com:123456/",
+  "http://example.com/%zz",
+  "http://example.com/a#b#c"
 };
 
 //----------------------------------------------------------------------------
 //!  
 //----------------------------------------------------------------------------
+static void TestNormalize()
+{
+  using Dwm::WebUtils::Url;
+  using Dwm::WebUtils::UrlView;
+  
+  static const pair<string,string>  cases[] = {
+    { "HTTP://Example.COM/", "http://example.com/" },
+    { "http://example.com:80", "http://example.com/" },
+    { "https://example.com:8443/a", "https://example.com:8443/a" },
+    { "http://example.com/%7euser/%2fx%3A",
+      "http://example.com/~user/%2Fx%3A" },
+    { "http://example.com/a/./b/../c", "http://example.com/a/c" },
+    { "http://example.com/a/b/../../..", "http://example.com/" },
+    { "http://example.com/./a/.", "http://example.com/a/" },
+    { "http://example.com/a/%2E%2E/b", "http://example.com/b" },
+    { "http://example.com/a/..b/c", "http://example.com/a/..b/c" },
+    { "http://example.com/p?%61=%7e#%7E", "http://example.com/p?a=~#~" },
+    { "http://[2001:DB8::7]/", "http://[2001:db8::7]/" }
+  };
+  for (const auto & c : cases) {
+    Url  url(c.first);
+    url.Normalize();
+    if (! UnitAssert(url.to_string(true) == c.second)) {
+      cerr << c.first << " -> " << url.to_string(true)
+           << " (expected " << c.second << ")\n";
+    }
+    Url  expected(c.second);
+    UnitAssert(url == expected);
+    UnitAssert(std::hash<Url>()(url)
+               == std::hash<Url>()(expected));
+    UnitAssert(url.Hash() == std::hash<UrlView>()(UrlView(url)));
+  }
+  UnitAssert(Url("http://a.com/x").Hash()
+             != Url("http://a.com/y").Hash());
+  return;
+}
+
 int main(int argc, char *argv[])
 {
   Dwm::WebUtils::Url  webUrl;
@@ -141,14 +197,38 @@ int main(int argc, char *argv[])
     Dwm::WebUtils::Url  webUrl2;
     UnitAssert(webUrl2.Parse(webUrl.to_string()));
     UnitAssert(webUrl2 == webUrl);
+
+    //  A UrlView must agree with the Url, and convert back to it.
+    Dwm::WebUtils::UrlView  urlView;
+    UnitAssert(urlView.Parse(goodUrls[i].url));
+    UnitAssert(urlView.Scheme() == webUrl.Scheme());
+    UnitAssert(urlView.UserInfo() == webUrl.UserInfo());
+    UnitAssert(urlView.Host() == webUrl.Host());
+    UnitAssert(urlView.Port() == webUrl.Port());
+    UnitAssert(urlView.Path() == webUrl.Path());
+    UnitAssert(urlView.Query() == webUrl.Query());
+    UnitAssert(urlView.Fragment() == webUrl.Fragment());
+    UnitAssert(urlView.to_string() == webUrl.to_string());
+    UnitAssert(urlView.AfterAuthority() == webUrl.AfterAuthority());
+    UnitAssert(Dwm::WebUtils::Url(urlView) == webUrl);
+    UnitAssert(Dwm::WebUtils::UrlView(webUrl) == urlView);
+    webUrl2.Clear();
+    webUrl2 = urlView;
+    UnitAssert(webUrl2 == webUrl);
   }
 
   for (int i = 0; i < sizeof(badUrls) / sizeof(badUrls[0]); ++i) {
     if (! UnitAssert(! webUrl.Parse(badUrls[i]))) {
       cerr << "failed on '" << badUrls[i] << "'\n";
     }
+    Dwm::WebUtils::UrlView  urlView;
+    if (! UnitAssert(! urlView.Parse(badUrls[i]))) {
+      cerr << "UrlView failed on '" << badUrls[i] << "'\n";
+    }
   }
       
+  TestNormalize();
+  
   if (Dwm::Assertions::Total().Failed())
     Dwm::Assertions::Print(cerr, true);
   else
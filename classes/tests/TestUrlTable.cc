@@ -0,0 +1,141 @@
+//===========================================================================
+// @(#) $DwmPath$
+//===========================================================================
+//  Copyright (c) Daniel W. McRobb 2026
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright
+//     notice, this list of conditions and the following disclaimer in the
+//     documentation and/or other materials provided with the distribution.
+//  3. The names of the authors and copyright holders may not be used to
+//     endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+//  IN NO EVENT SHALL DANIEL W. MCROBB BE LIABLE TO ANY PARTY FOR
+//  DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+//  INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS SOFTWARE,
+//  EVEN IF DANIEL W. MCROBB HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+//
+//  THE SOFTWARE PROVIDED HEREIN IS ON AN "AS IS" BASIS, AND
+//  DANIEL W. MCROBB HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT,
+//  UPDATES, ENHANCEMENTS, OR MODIFICATIONS. DANIEL W. MCROBB MAKES NO
+//  REPRESENTATIONS AND EXTENDS NO WARRANTIES OF ANY KIND, EITHER
+//  IMPLIED OR EXPRESS, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//  WARRANTIES OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE,
+//  OR THAT THE USE OF THIS SOFTWARE WILL NOT INFRINGE ANY PATENT,
+//  TRADEMARK OR OTHER RIGHTS.
+//===========================================================================
+//---------------------------------------------------------------------------
+//!  \file TestUrlTable.cc
+//!  \author Daniel W. McRobb
+//!  \brief Unit tests for Dwm::WebUtils::UrlTable
+//---------------------------------------------------------------------------
+
+#include <iostream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "DwmUnitAssert.hh"
+#include "DwmWebUtilsUrlTable.hh"
+
+using namespace std;
+using namespace Dwm::WebUtils;
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestIntern()
+{
+  UrlTable  table;
+  UrlTable::Id  id = table.Intern("http://Example.com/a/b/../c");
+  UnitAssert(0 == id);
+  UnitAssert(table.Intern("HTTP://example.COM:80/a/%63") == id);
+  UnitAssert(table.Intern(Url("http://example.com/a/./c")) == id);
+  UnitAssert(table.Intern("https://example.com/a/c") == 1);
+  UnitAssert(table.Intern("http://example.com/a/c?x") == 2);
+  UnitAssert(table.Intern("not a url") == UrlTable::k_noId);
+  UnitAssert(table.Size() == 3);
+  UnitAssert(table.Get(0).to_string(true) == "http://example.com/a/c");
+  UnitAssert(table.Get(1).Port() == 443);
+  UnitAssert(table.Find(Url("http://EXAMPLE.com/a/c")) == 0);
+  UnitAssert(table.Find(Url("http://example.com/b")) == UrlTable::k_noId);
+  bool  threw = false;
+  try {
+    table.Get(3);
+  }
+  catch (const std::out_of_range &) {
+    threw = true;
+  }
+  UnitAssert(threw);
+  table.Clear();
+  UnitAssert(table.Size() == 0);
+  UnitAssert(table.Find(Url("http://example.com/a/c")) == UrlTable::k_noId);
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  Interns from several threads at once; every thread must get the same
+//!  ID for the same URL.
+//----------------------------------------------------------------------------
+static void TestThreads()
+{
+  UrlTable  table;
+  vector<vector<UrlTable::Id>>  ids(4);
+  vector<thread>  threads;
+  for (size_t t = 0; t < ids.size(); ++t) {
+    threads.emplace_back([&table, &ids, t] {
+      for (int i = 0; i < 2000; ++i) {
+        string  url("http://host" + to_string(i % 500) + ".example.com/");
+        ids[t].push_back(table.Intern(url));
+      }
+    });
+  }
+  for (auto & th : threads) {
+    th.join();
+  }
+  UnitAssert(table.Size() == 500);
+  for (size_t t = 1; t < ids.size(); ++t) {
+    UnitAssert(ids[t] == ids[0]);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------
+//!  
+//----------------------------------------------------------------------------
+static void TestHash()
+{
+  unordered_set<Url>  urls;
+  urls.insert(Url("http://example.com/"));
+  urls.insert(Url("http://example.com:80/"));
+  urls.insert(Url("http://example.com"));
+  urls.insert(Url("https://example.com/"));
+  UnitAssert(urls.size() == 2);
+
+  string  s("http://example.com/x");
+  unordered_set<UrlView>  views;
+  views.insert(UrlView(s));
+  UnitAssert(views.count(UrlView(Url(s))) == 1);
+  return;
+}
+
+int main(int argc, char *argv[])
+{
+  TestIntern();
+  TestThreads();
+  TestHash();
+  
+  if (Dwm::Assertions::Total().Failed())
+    Dwm::Assertions::Print(cerr, true);
+  else
+    cout << Dwm::Assertions::Total() << " passed" << endl;
+
+}
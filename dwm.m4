@@ -891,6 +891,168 @@ define(DWM_CHECK_BOOSTASIO,[
   fi
 ])
 
+dnl #------------------------------------------------------------------------
+define(DWM_LINK_SIMDJSON,[
+  AC_LANG_PUSH(C++)
+  prev_CXXFLAGS="$CXXFLAGS"
+  prev_LIBS="$LIBS"
+  if [[ -n "$1" ]]; then
+    CXXFLAGS="$CXXFLAGS -I[$1]/include"
+    LIBS="$LIBS -L[$1]/lib -lsimdjson"
+  else
+    LIBS="$LIBS -lsimdjson"
+  fi
+  AC_LINK_IFELSE(
+    [AC_LANG_PROGRAM(
+      [[#include <simdjson.h>]],
+      [[simdjson::ondemand::parser  parser;
+        simdjson::padded_string  json("[1]", 3);
+        auto  doc = parser.iterate(json);]])
+    ],
+    [SIMDJSONDIR="$1"],
+    [SIMDJSONDIR="none"]
+  )
+  CXXFLAGS="$prev_CXXFLAGS"
+  LIBS="$prev_LIBS"
+  AC_LANG_POP()
+])
+
+dnl #------------------------------------------------------------------------
+dnl  Looks for simdjson.  If found, adds -DDWM_HAVE_SIMDJSON (and the
+dnl  include path) to CXXFLAGS and sets SIMDJSONLIBS.  Not required.
+define(DWM_CHECK_SIMDJSON,[
+  AC_MSG_CHECKING([for simdjson])
+  SIMDJSONLIBS=""
+  for simdjson_dir in "" "/usr/local" "/opt/local" "/opt/homebrew"; do
+    DWM_LINK_SIMDJSON([${simdjson_dir}])
+    if [[ "${SIMDJSONDIR}" != "none" ]]; then
+      break
+    fi
+  done
+  if [[ "${SIMDJSONDIR}" != "none" ]]; then
+    AC_MSG_RESULT([found ${SIMDJSONDIR}])
+    AC_DEFINE(HAVE_SIMDJSON)
+    CXXFLAGS="$CXXFLAGS -DDWM_HAVE_SIMDJSON"
+    if [[ -n "${SIMDJSONDIR}" ]]; then
+      CXXFLAGS="$CXXFLAGS -I${SIMDJSONDIR}/include"
+      SIMDJSONLIBS="-L${SIMDJSONDIR}/lib -lsimdjson"
+    else
+      SIMDJSONLIBS="-lsimdjson"
+    fi
+  else
+    AC_MSG_RESULT([not found])
+  fi
+  AC_SUBST(SIMDJSONLIBS)
+])
+
+dnl #------------------------------------------------------------------------
+define(DWM_LINK_BROTLI,[
+  AC_LANG_PUSH(C++)
+  prev_CXXFLAGS="$CXXFLAGS"
+  prev_LIBS="$LIBS"
+  if [[ -n "$1" ]]; then
+    CXXFLAGS="$CXXFLAGS -I[$1]/include"
+    LIBS="$LIBS -L[$1]/lib -lbrotlidec"
+  else
+    LIBS="$LIBS -lbrotlidec"
+  fi
+  AC_LINK_IFELSE(
+    [AC_LANG_PROGRAM(
+      [[#include <brotli/decode.h>]],
+      [[BrotliDecoderState  *s =
+          BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+        BrotliDecoderDestroyInstance(s);]])
+    ],
+    [BROTLIDIR="$1"],
+    [BROTLIDIR="none"]
+  )
+  CXXFLAGS="$prev_CXXFLAGS"
+  LIBS="$prev_LIBS"
+  AC_LANG_POP()
+])
+
+dnl #------------------------------------------------------------------------
+dnl  Looks for the brotli decoder library.  If found, adds -DDWM_HAVE_BROTLI
+dnl  (and the include path) to CXXFLAGS and appends to COMPRESSLIBS.  Not
+dnl  required.
+define(DWM_CHECK_BROTLI,[
+  AC_MSG_CHECKING([for brotli])
+  for brotli_dir in "" "/usr/local" "/opt/local" "/opt/homebrew"; do
+    DWM_LINK_BROTLI([${brotli_dir}])
+    if [[ "${BROTLIDIR}" != "none" ]]; then
+      break
+    fi
+  done
+  if [[ "${BROTLIDIR}" != "none" ]]; then
+    AC_MSG_RESULT([found ${BROTLIDIR}])
+    AC_DEFINE(HAVE_BROTLI)
+    CXXFLAGS="$CXXFLAGS -DDWM_HAVE_BROTLI"
+    if [[ -n "${BROTLIDIR}" ]]; then
+      CXXFLAGS="$CXXFLAGS -I${BROTLIDIR}/include"
+      COMPRESSLIBS="$COMPRESSLIBS -L${BROTLIDIR}/lib -lbrotlidec"
+    else
+      COMPRESSLIBS="$COMPRESSLIBS -lbrotlidec"
+    fi
+  else
+    AC_MSG_RESULT([not found])
+  fi
+  AC_SUBST(COMPRESSLIBS)
+])
+
+dnl #------------------------------------------------------------------------
+define(DWM_LINK_NGHTTP2,[
+  AC_LANG_PUSH(C++)
+  prev_CXXFLAGS="$CXXFLAGS"
+  prev_LIBS="$LIBS"
+  if [[ -n "$1" ]]; then
+    CXXFLAGS="$CXXFLAGS -I[$1]/include"
+    LIBS="$LIBS -L[$1]/lib -lnghttp2"
+  else
+    LIBS="$LIBS -lnghttp2"
+  fi
+  AC_LINK_IFELSE(
+    [AC_LANG_PROGRAM(
+      [[#include <nghttp2/nghttp2.h>]],
+      [[nghttp2_session_callbacks  *cbs;
+        nghttp2_session_callbacks_new(&cbs);
+        nghttp2_session_callbacks_del(cbs);]])
+    ],
+    [NGHTTP2DIR="$1"],
+    [NGHTTP2DIR="none"]
+  )
+  CXXFLAGS="$prev_CXXFLAGS"
+  LIBS="$prev_LIBS"
+  AC_LANG_POP()
+])
+
+dnl #------------------------------------------------------------------------
+dnl  Looks for nghttp2.  If found, adds -DDWM_HAVE_NGHTTP2 (and the include
+dnl  path) to CXXFLAGS and sets NGHTTP2LIBS.  Not required; without it
+dnl  we only speak HTTP/1.1.
+define(DWM_CHECK_NGHTTP2,[
+  AC_MSG_CHECKING([for nghttp2])
+  for nghttp2_dir in "" "/usr/local" "/opt/local" "/opt/homebrew"; do
+    DWM_LINK_NGHTTP2([${nghttp2_dir}])
+    if [[ "${NGHTTP2DIR}" != "none" ]]; then
+      break
+    fi
+  done
+  if [[ "${NGHTTP2DIR}" != "none" ]]; then
+    AC_MSG_RESULT([found ${NGHTTP2DIR}])
+    AC_DEFINE(HAVE_NGHTTP2)
+    CXXFLAGS="$CXXFLAGS -DDWM_HAVE_NGHTTP2"
+    if [[ -n "${NGHTTP2DIR}" ]]; then
+      CXXFLAGS="$CXXFLAGS -I${NGHTTP2DIR}/include"
+      NGHTTP2LIBS="-L${NGHTTP2DIR}/lib -lnghttp2"
+    else
+      NGHTTP2LIBS="-lnghttp2"
+    fi
+  else
+    AC_MSG_RESULT([not found])
+  fi
+  AC_SUBST(NGHTTP2LIBS)
+])
+
 dnl #-------------------------------------------------------------------------
 define(DWM_GIT_TAG,[
   gittag=`git describe --tags --dirty 2>/dev/null`